@@ -26,6 +26,7 @@ benchmark_option(BUILD_UR OFF)
 benchmark_option(BUILD_SYCL OFF)
 benchmark_option(BUILD_SYCL_WITH_CUDA OFF)
 benchmark_option(BUILD_OMP OFF)
+benchmark_option(BUILD_CPU ON)
 benchmark_option(BUILD_MPI OFF)
 if(BUILD_SYCL AND MSVC)
     set(BUILD_SYCL OFF)
@@ -21,11 +21,7 @@ static TestResult run(const Heat3DArguments &, Statistics &) {
 
 #else // WIN32
 
-#include "framework/utility/linux/ipc.h"
-
-#ifndef USE_PIDFD
-const std::string masterSocketName{"/tmp/heat3d.socket"};
-#endif // USE_PIDFD
+#include "framework/utility/linux/ipc_rendezvous.h"
 
 static TestResult
 ipcBarrierMaster(std::vector<ze_event_handle_t> &barrierEvents) {
@@ -67,20 +63,6 @@ static TestResult run(const Heat3DArguments &arguments,
     return TestResult::DeviceNotCapable;
   }
 
-  ze_host_mem_alloc_desc_t initBufferDesc = {};
-  initBufferDesc.stype = ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC;
-  initBufferDesc.pNext = nullptr;
-  initBufferDesc.flags = ZE_HOST_MEM_ALLOC_FLAG_BIAS_UNCACHED;
-  void *initBuffer;
-  ASSERT_ZE_RESULT_SUCCESS(zeMemAllocHost(levelzero.context, &initBufferDesc,
-                                          6 * nRanks * 1024, 0, &initBuffer));
-  std::fill_n(static_cast<uint8_t *>(initBuffer), 6 * nRanks * 1024, 0);
-  ze_ipc_mem_handle_t initBufferIpcHandle;
-  std::fill_n(initBufferIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE,
-              static_cast<char>(0));
-  ASSERT_ZE_RESULT_SUCCESS(
-      zeMemGetIpcHandle(levelzero.context, initBuffer, &initBufferIpcHandle));
-
   ze_event_pool_desc_t barrierEvPoolDesc = {};
   barrierEvPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
   barrierEvPoolDesc.pNext = nullptr;
@@ -108,17 +90,19 @@ static TestResult run(const Heat3DArguments &arguments,
         zeEventCreate(barrierEvPool, &barrierEventDesc, &barrierEvents[i]));
   }
 
+  // IPC handles are exchanged through a shared directory. Workers take ranks
+  // [0, nRanks) and the parent takes the last one to publish the event pool.
+  // Each worker publishes receive buffers of its six facets.
+  const uint32_t facetsCount = 6;
+  IpcRendezvous rendezvous{nRanks + 1, facetsCount};
+  rendezvous.setRank(nRanks);
+  rendezvous.publish(0, barrierEvPoolIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE,
+                     *reinterpret_cast<int *>(barrierEvPoolIpcHandle.data));
+
   ProcessGroup processes{"heat3d_workload_l0", nRanks};
   processes.addArgumentAll("iterations", std::to_string(arguments.iterations));
-  processes.addArgumentAll("parentPid", std::to_string(getpid()));
-#ifdef USE_PIDFD
-  processes.addArgumentAll(
-      "initBufferIpcHandle",
-      serializeBinaryToStr(initBufferIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE));
-  processes.addArgumentAll("evPoolIpcHandle",
-                           serializeBinaryToStr(barrierEvPoolIpcHandle.data,
-                                                ZE_MAX_IPC_HANDLE_SIZE));
-#endif // USE_PIDFD
+  processes.addArgumentAll("rendezvousFd",
+                           std::to_string(rendezvous.getDirectoryFd()));
   processes.addArgumentAll("nSubDomainX", std::to_string(arguments.subDomainX));
   processes.addArgumentAll("nSubDomainY", std::to_string(arguments.subDomainY));
   processes.addArgumentAll("nSubDomainZ", std::to_string(arguments.subDomainZ));
@@ -126,47 +110,17 @@ static TestResult run(const Heat3DArguments &arguments,
   processes.addArgumentAll("meshLength", std::to_string(arguments.meshLength));
 
   for (auto i = 0u; i < processes.size(); i++) {
+    processes[i].addHandleForInheritance(rendezvous.getDirectoryFd());
     processes[i].addArgument("rank", std::to_string(i));
     processes[i].setName("L0 Heat3D Process #" + std::to_string(i));
   }
 
   processes.runAll();
 
-  // For initParams
-#ifdef USE_PIDFD
-  // Wait for IPC handles to be written into the initBuffer
-  ipcBarrierMaster(barrierEvents);
-#else
-  int socketMaster = -1;
-  socketCreate(socketMaster);
-  socketBindAndListen(socketMaster, masterSocketName);
-
-  std::vector<int> socketWorkers{};
-  for (uint32_t i = 0; i < nRanks; i++) {
-    int socketWorker = -1;
-    socketAccept(socketMaster, socketWorkers, socketWorker);
-    socketSendDataWithFd(socketWorker,
-                         *reinterpret_cast<int *>(initBufferIpcHandle.data),
-                         initBufferIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE);
-    socketSendDataWithFd(socketWorker,
-                         *reinterpret_cast<int *>(barrierEvPoolIpcHandle.data),
-                         barrierEvPoolIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE);
-  }
-
-  for (auto sd : socketWorkers) {
-    EXPECT_EQ(0, close(sd));
-  }
-  EXPECT_EQ(0, close(socketMaster));
-
-  // Synchronize all the ranks when they exchange IPC handles through socket
-  for (uint32_t r = 0; r < nRanks; r++) {
-    if (nRanks == 1) {
-      break;
-    }
-    ipcBarrierMaster(barrierEvents);
-    ipcBarrierMaster(barrierEvents);
-  }
-#endif // USE_PIDFD
+  // Workers fetch the event pool first and receive buffers of their neighbors
+  // next. The parent takes part in both exchanges without requesting anything.
+  rendezvous.exchange({});
+  rendezvous.exchange({});
 
   for (auto i = 0u; i < arguments.iterations; i++) {
     // Init unpacking the receive buffers
@@ -191,9 +145,13 @@ static TestResult run(const Heat3DArguments &arguments,
       arguments.iterations, statistics, typeSelector.getUnit(),
       typeSelector.getType(), pushIndividualProcessesMeasurements, true);
 
-#ifndef USE_PIDFD
-  EXPECT_EQ(0, unlink(masterSocketName.c_str()));
-#endif // USE_PIDFD
+  // Handle exchange of the slowest rank is the setup cost of the whole group
+  std::chrono::nanoseconds setupTime{};
+  for (auto rank = 0u; rank < nRanks; rank++) {
+    setupTime = std::max(setupTime, rendezvous.getExchangeTime(rank));
+  }
+  statistics.pushSetupValue(setupTime, typeSelector.getUnit(),
+                            typeSelector.getType(), "setup");
 
   for (auto ev : barrierEvents) {
     ASSERT_ZE_RESULT_SUCCESS(zeEventDestroy(ev));
@@ -201,9 +159,6 @@ static TestResult run(const Heat3DArguments &arguments,
   // TODO: this fails
   zeEventPoolPutIpcHandle(levelzero.context, barrierEvPoolIpcHandle);
   ASSERT_ZE_RESULT_SUCCESS(zeEventPoolDestroy(barrierEvPool));
-  ASSERT_ZE_RESULT_SUCCESS(
-      zeMemPutIpcHandle(levelzero.context, initBufferIpcHandle));
-  ASSERT_ZE_RESULT_SUCCESS(zeMemFree(levelzero.context, initBuffer));
 
   return TestResult::Success;
 }
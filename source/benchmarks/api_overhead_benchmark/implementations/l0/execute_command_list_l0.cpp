@@ -1,13 +1,13 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/module_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/execute_command_list.h"
@@ -29,20 +29,14 @@ static TestResult run(const ExecuteCommandListArguments &arguments,
   Timer timer;
 
   // Create kernel
-  auto spirvModule =
-      FileHelper::loadBinaryFile("api_overhead_benchmark_empty_kernel.spv");
-  if (spirvModule.size() == 0) {
-    return TestResult::KernelNotFound;
-  }
   ze_module_handle_t module;
   ze_kernel_handle_t kernel;
-  ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
-  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
-  moduleDesc.pInputModule =
-      reinterpret_cast<const uint8_t *>(spirvModule.data());
-  moduleDesc.inputSize = spirvModule.size();
-  ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device,
-                                          &moduleDesc, &module, nullptr));
+  if (auto result = ModuleHelperL0::createModuleFromSpirvFile(
+          levelzero, "api_overhead_benchmark_empty_kernel.spv", nullptr,
+          module);
+      result != TestResult::Success) {
+    return result;
+  }
   ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
   kernelDesc.pKernelName = "empty";
   ASSERT_ZE_RESULT_SUCCESS(zeKernelCreate(module, &kernelDesc, &kernel));
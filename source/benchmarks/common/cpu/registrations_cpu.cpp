@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/cpu/print_device_info.h"
+#include "framework/print_device_info.h"
+#include "framework/supported_apis.h"
+#include "framework/utility/execute_at_app_init.h"
+
+EXECUTE_AT_APP_INIT {
+  DeviceInfo::registerFunctions(Api::CPU, CPU::printDeviceInfo,
+                                CPU::printAvailableDevices);
+  SupportedApis::registerSupportedApi(Api::CPU);
+};
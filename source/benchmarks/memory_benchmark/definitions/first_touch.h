@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/enum/host_allocation_policy_argument.h"
+#include "framework/argument/enum/page_population_argument.h"
+#include "framework/test_case/test_case.h"
+
+struct FirstTouchArguments : TestCaseArgumentContainer {
+  ByteSizeArgument size;
+  HostAllocationPolicyArgument pages;
+  PagePopulationArgument population;
+  PositiveIntegerArgument threads;
+
+  FirstTouchArguments()
+      : size(*this, "size", "Size of the mapping"),
+        pages(*this, "pages",
+              "Pages backing the mapping. Default follows system settings of "
+              "transparent huge pages"),
+        population(*this, "population",
+                   "How pages are populated before the buffer is touched. "
+                   "Touch populates them only by faults of the touch itself"),
+        threads(*this, "threads",
+                "Number of threads touching parts of the buffer") {}
+};
+
+struct FirstTouch : TestCase<FirstTouchArguments> {
+  using TestCase<FirstTouchArguments>::TestCase;
+
+  std::string getTestCaseName() const override { return "FirstTouch"; }
+
+  std::string getHelp() const override {
+    return "Measures cost of populating pages of a new anonymous host "
+           "mapping, which is the host-only part of first CPU access to "
+           "shared USM. \"populate\" is the time of mmap and the selected "
+           "population method, \"touch\" is the time of writing every 4KB of "
+           "the buffer afterwards and \"per page\" is their sum divided by "
+           "the number of pages. Userfaultfd resolves missing-page faults "
+           "in a handler thread copying zeroed pages. Linux only.";
+  }
+};
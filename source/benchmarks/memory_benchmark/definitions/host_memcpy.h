@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/enum/host_copy_method_argument.h"
+#include "framework/test_case/test_case.h"
+
+struct HostMemcpyArguments : TestCaseArgumentContainer {
+  ByteSizeArgument size;
+  HostCopyMethodArgument method;
+  PositiveIntegerArgument threads;
+  IntegerArgument srcNumaNode;
+  IntegerArgument dstNumaNode;
+
+  HostMemcpyArguments()
+      : size(*this, "size", "Size of the copy"),
+        method(*this, "method", "Instructions used for the copy"),
+        threads(*this, "threads",
+                "Number of threads copying parts of the buffer"),
+        srcNumaNode(*this, "srcNumaNode",
+                    "NUMA node of the source buffer. -1 means the node "
+                    "selected with --hostNumaNode"),
+        dstNumaNode(*this, "dstNumaNode",
+                    "NUMA node of the destination buffer. -1 means the node "
+                    "selected with --hostNumaNode") {
+    srcNumaNode = -1;
+    dstNumaNode = -1;
+  }
+};
+
+struct HostMemcpy : TestCase<HostMemcpyArguments> {
+  using TestCase<HostMemcpyArguments>::TestCase;
+
+  std::string getTestCaseName() const override { return "HostMemcpy"; }
+
+  std::string getHelp() const override {
+    return "Measures bandwidth of a copy between two host buffers. Threads "
+           "are placed according to --cpuPlacement, so together with NUMA "
+           "nodes of the buffers both local and remote copies can be "
+           "measured. Copies smaller than 1MB are repeated within a single "
+           "measurement, so timer overhead is negligible. Multithreaded "
+           "copies wake up the threads for each repetition.";
+  }
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@ struct RandomAccessArguments : TestCaseArgumentContainer {
   PositiveIntegerArgument alignment;
   StringArgument accessMode;
   PositiveIntegerArgument randomAccessRange;
+  BooleanArgument pointerChase;
 
   RandomAccessArguments()
       : allocationSize(*this, "allocationSize",
@@ -27,7 +28,13 @@ struct RandomAccessArguments : TestCaseArgumentContainer {
                    "Access mode to be used('Read', 'Write', 'ReadWrite')"),
         randomAccessRange(
             *this, "randomAccessRange",
-            "Percentage of allocation size to be used for random access") {}
+            "Percentage of allocation size to be used for random access"),
+        pointerChase(*this, "pointerChase",
+                     "Measure latency of dependent loads following a random "
+                     "cycle of pointers instead of bandwidth of independent "
+                     "accesses. Supported only on CPU with Read access mode") {
+    pointerChase = false;
+  }
 };
 
 struct RandomAccess : TestCase<RandomAccessArguments> {
@@ -38,6 +45,9 @@ struct RandomAccess : TestCase<RandomAccessArguments> {
   std::string getHelp() const override {
     return "Measures device-memory random access bandwidth for different "
            "allocation sizes, alignments and access modes."
-           "The benchmark uses 10 million accesses to memory.";
+           "The benchmark uses 10 million accesses to memory. On CPU, host "
+           "memory is accessed by all logical cores with prefetched batches "
+           "of random indices, or by a single thread chasing pointers when "
+           "latency is measured.";
   }
 };
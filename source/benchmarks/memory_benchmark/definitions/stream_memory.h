@@ -20,6 +20,8 @@ struct StreamMemoryArguments : TestCaseArgumentContainer {
   BufferContentsArgument contents;
   UsmMemoryPlacementArgument memoryPlacement;
   PositiveIntegerArgument partialMultiplier;
+  BooleanArgument nonTemporal;
+  NonNegativeIntegerArgument threads;
 
   StreamMemoryArguments()
       : type(*this, "type", "Memory streaming type"),
@@ -32,7 +34,16 @@ struct StreamMemoryArguments : TestCaseArgumentContainer {
                         "Memory type used for stream"),
         partialMultiplier(*this, "multiplier",
                           "multiplies id used for accessing the resources to "
-                          "simulate partials") {}
+                          "simulate partials"),
+        nonTemporal(*this, "nonTemporal",
+                    "Use non-temporal stores, which bypass caches. Supported "
+                    "only on CPU"),
+        threads(*this, "threads",
+                "Number of host threads streaming the memory on CPU. 0 means "
+                "one thread per logical core") {
+    nonTemporal = false;
+    threads = 0;
+  }
 };
 
 struct StreamMemory : TestCase<StreamMemoryArguments> {
@@ -47,6 +58,7 @@ struct StreamMemory : TestCase<StreamMemoryArguments> {
            "Triad means two "
            "buffers are read and one is written to. In read and write memory "
            "is only read or "
-           "written to.";
+           "written to. On CPU, host memory is streamed by a team of threads "
+           "with the widest available vector instructions.";
   }
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,13 +17,25 @@ struct UsmCopyStagingBuffersArguments : TestCaseArgumentContainer {
   UsmMemoryPlacementArgument dstPlacement;
   ByteSizeArgument size;
   PositiveIntegerArgument chunks;
+  NonNegativeIntegerArgument depth;
+  PositiveIntegerArgument hostThreads;
 
   UsmCopyStagingBuffersArguments()
       : forceBlitter(*this, "forceBlitter", CommonHelpMessage::forceBlitter()),
         dstPlacement(*this, "dst", "Memory placement of destination"),
         size(*this, "size", "Size of the buffer"),
         chunks(*this, "chunks",
-               "How much memory chunks should the buffer be splitted into") {}
+               "How much memory chunks should the buffer be splitted into"),
+        depth(*this, "depth",
+              "Number of staging buffers the chunks are pipelined through, so "
+              "host copy of a chunk overlaps device copy of the previous one. "
+              "0 means a staging buffer per chunk without overlapping"),
+        hostThreads(*this, "hostThreads",
+                    "Number of threads doing host copies of pipelined chunks "
+                    "with non-temporal stores") {
+    depth = 0;
+    hostThreads = 1;
+  }
 };
 
 struct UsmCopyStagingBuffers : TestCase<UsmCopyStagingBuffersArguments> {
@@ -37,6 +49,8 @@ struct UsmCopyStagingBuffers : TestCase<UsmCopyStagingBuffersArguments> {
     return "Measures copy time from device/host to host/device. Host memory is "
            "non-USM allocation."
            "Copy is done through staging USM buffers. Non-USM host ptr is "
-           "never passed to L0 API, only through staging buffers.";
+           "never passed to L0 API, only through staging buffers. With "
+           "depth greater than 0 host and device copies of consecutive "
+           "chunks are pipelined.";
   }
 };
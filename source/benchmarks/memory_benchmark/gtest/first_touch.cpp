@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "definitions/first_touch.h"
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/memory_constants.h"
+
+#include <gtest/gtest.h>
+
+[[maybe_unused]] static const inline RegisterTestCase<FirstTouch>
+    registerTestCase{};
+
+class FirstTouchTest
+    : public ::testing::TestWithParam<
+          std::tuple<size_t, HostAllocationPolicy, PagePopulation, size_t>> {};
+
+TEST_P(FirstTouchTest, Test) {
+  FirstTouchArguments args{};
+  args.api = Api::CPU;
+  args.size = std::get<0>(GetParam());
+  args.pages = std::get<1>(GetParam());
+  args.population = std::get<2>(GetParam());
+  args.threads = std::get<3>(GetParam());
+
+  FirstTouch test;
+  test.run(args);
+}
+
+using namespace MemoryConstants;
+INSTANTIATE_TEST_SUITE_P(
+    FirstTouchTest, FirstTouchTest,
+    ::testing::Combine(
+        ::testing::Values(4 * megaByte, 64 * megaByte, 1 * gigaByte),
+        ::testing::Values(HostAllocationPolicy::SmallPages,
+                          HostAllocationPolicy::TransparentHugePages,
+                          HostAllocationPolicy::HugeTlb2M),
+        ::testing::Values(PagePopulation::Touch, PagePopulation::MapPopulate,
+                          PagePopulation::WillNeed,
+                          PagePopulation::PopulateWrite,
+                          PagePopulation::Userfaultfd),
+        ::testing::Values(1, 4, 16)));
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "definitions/host_memcpy.h"
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/memory_constants.h"
+
+#include <gtest/gtest.h>
+
+[[maybe_unused]] static const inline RegisterTestCase<HostMemcpy>
+    registerTestCase{};
+
+class HostMemcpyTest
+    : public ::testing::TestWithParam<
+          std::tuple<size_t, HostCopyMethod, size_t>> {};
+
+TEST_P(HostMemcpyTest, Test) {
+  HostMemcpyArguments args{};
+  args.api = Api::CPU;
+  args.size = std::get<0>(GetParam());
+  args.method = std::get<1>(GetParam());
+  args.threads = std::get<2>(GetParam());
+
+  HostMemcpy test;
+  test.run(args);
+}
+
+using namespace MemoryConstants;
+INSTANTIATE_TEST_SUITE_P(
+    HostMemcpyTest, HostMemcpyTest,
+    ::testing::Combine(
+        ::testing::Values(64, 4 * kiloByte, 256 * kiloByte, 4 * megaByte,
+                          64 * megaByte, 1 * gigaByte, 4 * gigaByte),
+        ::testing::Values(HostCopyMethod::Memcpy, HostCopyMethod::RepMovsb,
+                          HostCopyMethod::Avx2, HostCopyMethod::Avx2NonTemporal,
+                          HostCopyMethod::Avx512,
+                          HostCopyMethod::Avx512NonTemporal),
+        ::testing::Values(1, 4, 16)));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,17 +16,18 @@
 [[maybe_unused]] static const inline RegisterTestCase<RandomAccess>
     registerTestCase{};
 
-class RandomAccessTest : public ::testing::TestWithParam<
-                             std::tuple<size_t, size_t, std::string, size_t>> {
-};
+class RandomAccessTest
+    : public ::testing::TestWithParam<
+          std::tuple<Api, size_t, size_t, std::string, size_t, bool>> {};
 
 TEST_P(RandomAccessTest, Test) {
   RandomAccessArguments args;
-  args.api = Api::L0;
-  args.allocationSize = std::get<0>(GetParam());
-  args.alignment = std::get<1>(GetParam());
-  args.accessMode = std::get<2>(GetParam());
-  args.randomAccessRange = std::get<3>(GetParam());
+  args.api = std::get<0>(GetParam());
+  args.allocationSize = std::get<1>(GetParam());
+  args.alignment = std::get<2>(GetParam());
+  args.accessMode = std::get<3>(GetParam());
+  args.randomAccessRange = std::get<4>(GetParam());
+  args.pointerChase = std::get<5>(GetParam());
 
   RandomAccess test;
   test.run(args);
@@ -35,8 +36,26 @@ TEST_P(RandomAccessTest, Test) {
 using namespace MemoryConstants;
 INSTANTIATE_TEST_SUITE_P(
     RandomAccessTest, RandomAccessTest,
-    ::testing::Combine(::testing::Values(256 * megaByte, 1 * gigaByte,
+    ::testing::Combine(::testing::Values(Api::L0),
+                       ::testing::Values(256 * megaByte, 1 * gigaByte,
                                          8 * gigaByte, 16 * gigaByte),
                        ::testing::Values(64 * kiloByte, 1 * gigaByte),
                        ::testing::Values("Read", "Write", "ReadWrite"),
-                       ::testing::Values(100)));
\ No newline at end of file
+                       ::testing::Values(100), ::testing::Values(false)));
+
+INSTANTIATE_TEST_SUITE_P(
+    RandomAccessTestCpu, RandomAccessTest,
+    ::testing::Combine(::testing::Values(Api::CPU),
+                       ::testing::Values(256 * megaByte, 1 * gigaByte),
+                       ::testing::Values(64 * kiloByte),
+                       ::testing::Values("Read", "Write", "ReadWrite"),
+                       ::testing::Values(100), ::testing::Values(false)));
+
+INSTANTIATE_TEST_SUITE_P(
+    RandomAccessTestCpuPointerChase, RandomAccessTest,
+    ::testing::Combine(::testing::Values(Api::CPU),
+                       ::testing::Values(1 * megaByte, 32 * megaByte,
+                                         256 * megaByte, 1 * gigaByte),
+                       ::testing::Values(64 * kiloByte),
+                       ::testing::Values("Read"), ::testing::Values(100),
+                       ::testing::Values(true)));
\ No newline at end of file
@@ -19,7 +19,7 @@
 class StreamMemoryTest
     : public ::testing::TestWithParam<
           std::tuple<Api, StreamMemoryType, size_t, bool, BufferContents,
-                     UsmMemoryPlacement, size_t>> {};
+                     UsmMemoryPlacement, size_t, bool>> {};
 
 TEST_P(StreamMemoryTest, Test) {
   StreamMemoryArguments args;
@@ -30,6 +30,7 @@ TEST_P(StreamMemoryTest, Test) {
   args.contents = std::get<4>(GetParam());
   args.memoryPlacement = std::get<5>(GetParam());
   args.partialMultiplier = std::get<6>(GetParam());
+  args.nonTemporal = std::get<7>(GetParam());
 
   StreamMemory test;
   test.run(args);
@@ -46,4 +47,16 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(false, true),
         ::testing::Values(BufferContents::Zeros, BufferContents::Random),
         ::testing::ValuesIn(UsmMemoryPlacementArgument::deviceAndHost),
-        ::testing::Values(1u)));
+        ::testing::Values(1u), ::testing::Values(false)));
+
+INSTANTIATE_TEST_SUITE_P(
+    StreamMemoryTestCpu, StreamMemoryTest,
+    ::testing::Combine(
+        ::testing::Values(Api::CPU),
+        ::testing::ValuesIn(StreamMemoryTypeArgument::enumValues),
+        ::testing::Values(1 * megaByte, 32 * megaByte, 512 * megaByte,
+                          1 * gigaByte),
+        ::testing::Values(false),
+        ::testing::Values(BufferContents::Zeros, BufferContents::Random),
+        ::testing::Values(UsmMemoryPlacement::Host), ::testing::Values(1u),
+        ::testing::Values(false, true)));
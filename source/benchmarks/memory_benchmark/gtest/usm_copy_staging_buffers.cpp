@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,7 +17,8 @@
 
 class UsmCopyStagingBuffersTest
     : public ::testing::TestWithParam<
-          std::tuple<Api, bool, UsmMemoryPlacement, size_t, size_t>> {};
+          std::tuple<Api, bool, UsmMemoryPlacement, size_t, size_t,
+                     size_t, size_t>> {};
 
 TEST_P(UsmCopyStagingBuffersTest, DISABLED_Test) {
   UsmCopyStagingBuffersArguments args;
@@ -26,6 +27,8 @@ TEST_P(UsmCopyStagingBuffersTest, DISABLED_Test) {
   args.dstPlacement = std::get<2>(GetParam());
   args.size = std::get<3>(GetParam());
   args.chunks = std::get<4>(GetParam());
+  args.depth = std::get<5>(GetParam());
+  args.hostThreads = std::get<6>(GetParam());
 
   UsmCopyStagingBuffers test;
   test.run(args);
@@ -41,4 +44,23 @@ INSTANTIATE_TEST_SUITE_P(
                           128 * kiloByte, 1 * megaByte, 2 * megaByte,
                           16 * megaByte, 32 * megaByte, 128 * megaByte,
                           512 * megaByte),
-        ::testing::Values(1, 2, 4, 8)));
+        ::testing::Values(1, 2, 4, 8), ::testing::Values(0),
+        ::testing::Values(1)));
+
+INSTANTIATE_TEST_SUITE_P(
+    UsmCopyStagingBuffersTestPipelined, UsmCopyStagingBuffersTest,
+    ::testing::Combine(
+        ::CommonGtestArgs::allApis(), ::testing::Values(false, true),
+        ::testing::Values(UsmMemoryPlacement::Device, UsmMemoryPlacement::Host),
+        ::testing::Values(16 * megaByte, 128 * megaByte, 512 * megaByte),
+        ::testing::Values(8, 32), ::testing::Values(2, 3),
+        ::testing::Values(1, 4)));
+
+INSTANTIATE_TEST_SUITE_P(
+    UsmCopyStagingBuffersTestCpu, UsmCopyStagingBuffersTest,
+    ::testing::Combine(
+        ::testing::Values(Api::CPU), ::testing::Values(false),
+        ::testing::Values(UsmMemoryPlacement::Device, UsmMemoryPlacement::Host),
+        ::testing::Values(16 * megaByte, 128 * megaByte),
+        ::testing::Values(8, 32), ::testing::Values(0, 2, 3),
+        ::testing::Values(1, 4)));
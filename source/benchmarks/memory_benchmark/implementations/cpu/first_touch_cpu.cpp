@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/memory_constants.h"
+#include "framework/utility/thread_team.h"
+#include "framework/utility/timer.h"
+
+#include "definitions/first_touch.h"
+
+#include <gtest/gtest.h>
+
+#ifdef WIN32
+
+static TestResult run(const FirstTouchArguments &, Statistics &) {
+  return TestResult::NoImplementation;
+}
+
+#else // WIN32
+
+#include "framework/utility/linux/error.h"
+
+#include <atomic>
+#include <fcntl.h>
+#include <linux/mman.h>
+#include <linux/userfaultfd.h>
+#include <memory>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23 // Linux 5.14
+#endif
+#ifndef UFFD_USER_MODE_ONLY
+#define UFFD_USER_MODE_ONLY 1 // Linux 5.11
+#endif
+
+constexpr static size_t touchStride = 4 * MemoryConstants::kiloByte;
+
+// Resolves missing-page faults of registered ranges by copying a zeroed page
+// into them, the way post-copy migration populates memory
+class UserfaultfdPopulator {
+public:
+  explicit UserfaultfdPopulator(size_t pageSize)
+      : pageSize(pageSize), sourcePage(pageSize, 0) {
+    // Handling faults of user space only does not require privileges
+    fd = static_cast<int>(syscall(SYS_userfaultfd,
+                                  O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+    if (fd < 0) {
+      fd = static_cast<int>(syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK));
+    }
+    if (fd < 0) {
+      return;
+    }
+
+    uffdio_api api{};
+    api.api = UFFD_API;
+    if (ioctl(fd, UFFDIO_API, &api) != 0) {
+      close(fd);
+      fd = -1;
+      return;
+    }
+    handler = std::thread(&UserfaultfdPopulator::handleFaults, this);
+  }
+
+  ~UserfaultfdPopulator() {
+    if (handler.joinable()) {
+      stopping.store(true, std::memory_order_release);
+      handler.join();
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+
+  bool isOpened() const { return fd >= 0; }
+
+  bool registerRange(void *address, size_t size) {
+    uffdio_register range{};
+    range.range.start = reinterpret_cast<uintptr_t>(address);
+    range.range.len = size;
+    range.mode = UFFDIO_REGISTER_MODE_MISSING;
+    return ioctl(fd, UFFDIO_REGISTER, &range) == 0;
+  }
+
+private:
+  void handleFaults() {
+    while (!stopping.load(std::memory_order_acquire)) {
+      pollfd descriptor{fd, POLLIN, 0};
+      if (poll(&descriptor, 1, 1) <= 0) {
+        continue;
+      }
+      uffd_msg message{};
+      if (read(fd, &message, sizeof(message)) != sizeof(message) ||
+          message.event != UFFD_EVENT_PAGEFAULT) {
+        continue;
+      }
+
+      // EEXIST means another fault of the same page has been resolved first
+      uffdio_copy copy{};
+      copy.dst = message.arg.pagefault.address & ~(pageSize - 1);
+      copy.src = reinterpret_cast<uintptr_t>(sourcePage.data());
+      copy.len = pageSize;
+      ioctl(fd, UFFDIO_COPY, &copy);
+    }
+  }
+
+  const size_t pageSize;
+  const std::vector<uint8_t> sourcePage;
+  int fd = -1;
+  std::thread handler = {};
+  std::atomic<bool> stopping{false};
+};
+
+static size_t getPageSize(HostAllocationPolicy pages) {
+  switch (pages) {
+  case HostAllocationPolicy::TransparentHugePages:
+  case HostAllocationPolicy::HugeTlb2M:
+    return sizeOf2MB;
+  case HostAllocationPolicy::HugeTlb1G:
+    return MemoryConstants::gigaByte;
+  default:
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
+}
+
+static int getMapFlags(HostAllocationPolicy pages) {
+  switch (pages) {
+  case HostAllocationPolicy::HugeTlb2M:
+    return MAP_HUGETLB | MAP_HUGE_2MB;
+  case HostAllocationPolicy::HugeTlb1G:
+    return MAP_HUGETLB | MAP_HUGE_1GB;
+  default:
+    return 0;
+  }
+}
+
+static TestResult run(const FirstTouchArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::Microseconds,
+                                 MeasurementType::Cpu);
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  // Setup
+  const HostAllocationPolicy pages = arguments.pages;
+  const PagePopulation population = arguments.population;
+  const size_t pageSize = getPageSize(pages);
+  const size_t size = alignUp(arguments.size, pageSize);
+  const size_t pagesCount = size / pageSize;
+  ThreadTeam team{arguments.threads};
+  Timer populateTimer;
+  Timer touchTimer;
+
+  std::unique_ptr<UserfaultfdPopulator> populator;
+  if (population == PagePopulation::Userfaultfd) {
+    populator = std::make_unique<UserfaultfdPopulator>(pageSize);
+    if (!populator->isOpened()) {
+      return TestResult::DeviceNotCapable;
+    }
+  }
+
+  // Transparent huge pages are used only for aligned parts of a mapping, so
+  // more is mapped and the buffer starts at an aligned address
+  const size_t padding =
+      pages == HostAllocationPolicy::TransparentHugePages ? pageSize : 0;
+  const int mapFlags = MAP_PRIVATE | MAP_ANONYMOUS | getMapFlags(pages) |
+                       (population == PagePopulation::MapPopulate ? MAP_POPULATE
+                                                                  : 0);
+  uint8_t *buffer = nullptr;
+  const ThreadTeam::Job touch = [&](size_t threadIndex, size_t threadsCount) {
+    const size_t partSize =
+        alignUp((size + threadsCount - 1) / threadsCount, pageSize);
+    const size_t begin = std::min(threadIndex * partSize, size);
+    const size_t end = std::min(begin + partSize, size);
+    for (size_t offset = begin; offset < end; offset += touchStride) {
+      buffer[offset] = 1;
+    }
+  };
+
+  // Benchmark
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    populateTimer.measureStart();
+    void *base = mmap(nullptr, size + padding, PROT_READ | PROT_WRITE,
+                      mapFlags, -1, 0);
+    if (base == MAP_FAILED && getMapFlags(pages) != 0) {
+      // Huge pages have not been reserved in /sys/kernel/mm/hugepages
+      return TestResult::DeviceNotCapable;
+    }
+    FATAL_ERROR_IF(base == MAP_FAILED, "mmap failed, ", getErrorFromErrno());
+    buffer = reinterpret_cast<uint8_t *>(
+        alignUp(reinterpret_cast<uintptr_t>(base), pageSize));
+    if (pages == HostAllocationPolicy::TransparentHugePages) {
+      madvise(buffer, size, MADV_HUGEPAGE);
+    } else if (pages == HostAllocationPolicy::SmallPages) {
+      madvise(buffer, size, MADV_NOHUGEPAGE);
+    }
+
+    bool populated = true;
+    switch (population) {
+    case PagePopulation::WillNeed:
+      populated = madvise(buffer, size, MADV_WILLNEED) == 0;
+      break;
+    case PagePopulation::PopulateWrite:
+      populated = madvise(buffer, size, MADV_POPULATE_WRITE) == 0;
+      break;
+    case PagePopulation::Userfaultfd:
+      populated = populator->registerRange(buffer, size);
+      break;
+    default:
+      break;
+    }
+    populateTimer.measureEnd();
+    if (!populated) {
+      munmap(base, size + padding);
+      return TestResult::DeviceNotCapable;
+    }
+
+    touchTimer.measureStart();
+    team.run(touch);
+    touchTimer.measureEnd();
+
+    FATAL_ERROR_IF_SYS_CALL_FAILED(munmap(base, size + padding),
+                                   "munmap failed");
+
+    statistics.pushValue(populateTimer.get(), typeSelector.getUnit(),
+                         typeSelector.getType(), "populate");
+    statistics.pushValue(touchTimer.get(), typeSelector.getUnit(),
+                         typeSelector.getType(), "touch");
+    statistics.pushValue((populateTimer.get() + touchTimer.get()) / pagesCount,
+                         MeasurementUnit::Nanoseconds, typeSelector.getType(),
+                         "per page");
+  }
+
+  return TestResult::Success;
+}
+
+#endif // WIN32
+
+static RegisterTestCaseImplementation<FirstTouch> registerTestCase(run,
+                                                                   Api::CPU);
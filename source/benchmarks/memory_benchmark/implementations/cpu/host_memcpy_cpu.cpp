@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/buffer_contents_helper.h"
+#include "framework/utility/cpu_placement.h"
+#include "framework/utility/host_allocator.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/host_copy.h"
+#include "framework/utility/memory_constants.h"
+#include "framework/utility/thread_team.h"
+#include "framework/utility/timer.h"
+
+#include "definitions/host_memcpy.h"
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+
+constexpr static size_t minimumBytesPerMeasurement = MemoryConstants::megaByte;
+
+static void *allocateOnNode(size_t size, int64_t numaNode) {
+  void *buffer = HostAllocator::allocate(size, 4 * MemoryConstants::kiloByte);
+  if (numaNode >= 0) {
+    CpuPlacementSlot slot{};
+    slot.numaNodes.push_back(static_cast<size_t>(numaNode));
+    CpuPlacement::bindMemory(buffer, size, slot);
+  }
+  return buffer;
+}
+
+static TestResult run(const HostMemcpyArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::GigabytesPerSecond,
+                                 MeasurementType::Cpu);
+
+  if (arguments.srcNumaNode < -1 || arguments.dstNumaNode < -1) {
+    return TestResult::InvalidArgs;
+  }
+  if (!HostCopy::isSupported(arguments.method)) {
+    return TestResult::DeviceNotCapable;
+  }
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  // Setup
+  const size_t size = arguments.size;
+  const size_t repetitions =
+      std::max<size_t>(minimumBytesPerMeasurement / size, 1);
+  ThreadTeam team{arguments.threads};
+  Timer timer;
+
+  auto src = static_cast<uint8_t *>(
+      allocateOnNode(size, arguments.srcNumaNode));
+  auto dst = static_cast<uint8_t *>(
+      allocateOnNode(size, arguments.dstNumaNode));
+  BufferContentsHelper::fill(src, size, BufferContents::Random);
+
+  // Warmup and verification
+  HostCopy::copy(dst, src, size, arguments.method, team);
+  if (std::memcmp(dst, src, size) != 0) {
+    HostAllocator::free(src);
+    HostAllocator::free(dst);
+    return TestResult::VerificationFail;
+  }
+
+  // Benchmark
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    HostCache::prepare(src, size);
+    HostCache::prepare(dst, size);
+
+    timer.measureStart();
+    for (size_t repetition = 0; repetition < repetitions; repetition++) {
+      HostCopy::copy(dst, src, size, arguments.method, team);
+    }
+    timer.measureEnd();
+
+    statistics.pushValue(timer.get(), size * repetitions,
+                         typeSelector.getUnit(), typeSelector.getType());
+  }
+
+  // Cleanup
+  HostAllocator::free(src);
+  HostAllocator::free(dst);
+
+  return TestResult::Success;
+}
+
+static RegisterTestCaseImplementation<HostMemcpy> registerTestCase(run,
+                                                                   Api::CPU);
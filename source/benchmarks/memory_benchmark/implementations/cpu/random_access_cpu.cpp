@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/memory_constants.h"
+#include "framework/utility/thread_team.h"
+#include "framework/utility/timer.h"
+
+#include "definitions/random_access.h"
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
+enum class AccessMode { Unknown, Read, Write, ReadWrite };
+
+static AccessMode getAccessMode(const std::string &accessModeString) {
+  if (accessModeString == "Read" || accessModeString == "READ") {
+    return AccessMode::Read;
+  }
+  if (accessModeString == "Write" || accessModeString == "WRITE") {
+    return AccessMode::Write;
+  }
+  if (accessModeString == "ReadWrite" || accessModeString == "READWRITE") {
+    return AccessMode::ReadWrite;
+  }
+  return AccessMode::Unknown;
+}
+
+// Same number of accesses as in the device kernel
+constexpr static size_t accessesCount = 10 * MemoryConstants::megaByte;
+constexpr static size_t cacheLineSize = 64;
+constexpr static uint32_t writeValue = 0xFFAABBCC;
+
+// Indices are produced in batches by independent xorshift generators, one per
+// lane. Lanes have no dependencies between each other, so the loop is
+// vectorized by the compiler.
+class IndexGenerator {
+public:
+  constexpr static size_t batchSize = 16;
+  using Batch = uint64_t[batchSize];
+
+  IndexGenerator(size_t threadIndex, uint64_t range) : range(range) {
+    std::seed_seq seed{threadIndex};
+    std::mt19937_64 seedGenerator{seed};
+    for (auto &state : states) {
+      do {
+        state = seedGenerator();
+      } while (state == 0);
+    }
+  }
+
+  void generate(Batch &indices) {
+    for (size_t lane = 0; lane < batchSize; lane++) {
+      uint64_t state = states[lane];
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      states[lane] = state;
+
+      // Scales upper 32 bits to [0, range) without a division
+      indices[lane] = ((state >> 32) * range) >> 32;
+    }
+  }
+
+private:
+  const uint64_t range;
+  uint64_t states[batchSize] = {};
+};
+
+static inline void prefetch(const void *address, bool forWrite) {
+#if defined(_MSC_VER)
+  _mm_prefetch(static_cast<const char *>(address),
+               forWrite ? _MM_HINT_ET0 : _MM_HINT_T0);
+#else
+  if (forWrite) {
+    __builtin_prefetch(address, 1);
+  } else {
+    __builtin_prefetch(address, 0);
+  }
+#endif
+}
+
+// Accesses of the current batch are issued while the next batch is already
+// being prefetched, so many cache misses are in flight at the same time
+template <AccessMode accessMode>
+static uint32_t accessRandomly(uint32_t *buffer, uint64_t range,
+                               size_t batchesCount, size_t threadIndex) {
+  constexpr bool forWrite = accessMode != AccessMode::Read;
+  IndexGenerator generator{threadIndex, range};
+  IndexGenerator::Batch batches[2];
+  generator.generate(batches[0]);
+  for (auto index : batches[0]) {
+    prefetch(buffer + index, forWrite);
+  }
+
+  uint32_t sum = 0;
+  for (size_t batchIndex = 0; batchIndex < batchesCount; batchIndex++) {
+    IndexGenerator::Batch &current = batches[batchIndex % 2];
+    IndexGenerator::Batch &next = batches[(batchIndex + 1) % 2];
+    generator.generate(next);
+    for (auto index : next) {
+      prefetch(buffer + index, forWrite);
+    }
+
+    for (auto index : current) {
+      if constexpr (accessMode == AccessMode::Read) {
+        sum += buffer[index];
+      } else if constexpr (accessMode == AccessMode::Write) {
+        buffer[index] = writeValue;
+      } else {
+        buffer[index] ^= static_cast<uint32_t>(index);
+      }
+    }
+  }
+  return sum;
+}
+
+// Links cache lines into a single random cycle with Sattolo's algorithm. The
+// first word of each line holds the index of the next line.
+static void createPointerCycle(uint32_t *buffer, size_t linesCount) {
+  constexpr size_t wordsPerLine = cacheLineSize / sizeof(uint32_t);
+  for (size_t line = 0; line < linesCount; line++) {
+    buffer[line * wordsPerLine] = static_cast<uint32_t>(line);
+  }
+
+  std::mt19937_64 generator{linesCount};
+  for (size_t line = linesCount - 1; line > 0; line--) {
+    std::uniform_int_distribution<size_t> distribution(0, line - 1);
+    std::swap(buffer[line * wordsPerLine],
+              buffer[distribution(generator) * wordsPerLine]);
+  }
+}
+
+static uint32_t chasePointers(const uint32_t *buffer, size_t count) {
+  constexpr size_t wordsPerLine = cacheLineSize / sizeof(uint32_t);
+  uint32_t line = 0;
+  for (size_t i = 0; i < count; i++) {
+    line = buffer[line * wordsPerLine];
+  }
+  return line;
+}
+
+static TestResult run(const RandomAccessArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(arguments.pointerChase
+                                     ? MeasurementUnit::Nanoseconds
+                                     : MeasurementUnit::GigabytesPerSecond,
+                                 MeasurementType::Cpu);
+
+  const AccessMode accessMode = getAccessMode(arguments.accessMode);
+  if (accessMode == AccessMode::Unknown) {
+    return TestResult::InvalidArgs;
+  }
+  if (arguments.pointerChase && accessMode != AccessMode::Read) {
+    return TestResult::NoImplementation;
+  }
+  const size_t alignment = arguments.alignment;
+  if ((alignment & (alignment - 1)) != 0) {
+    return TestResult::InvalidArgs;
+  }
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  // Setup
+  ThreadTeam team{arguments.pointerChase ? 1u : 0u};
+  Timer timer;
+  const size_t allocationSize = arguments.allocationSize;
+  const size_t rangeSize =
+      allocationSize * std::min<size_t>(arguments.randomAccessRange, 100) / 100;
+  const size_t rangeElements =
+      std::max<size_t>(rangeSize / sizeof(uint32_t), 1);
+  const size_t linesCount = rangeSize / cacheLineSize;
+  if (arguments.pointerChase && linesCount < 2) {
+    return TestResult::InvalidArgs;
+  }
+
+  // Create buffer. Its pages are touched by all threads, so they are spread
+  // among the threads evenly.
+  const size_t padding = alignment > sizeOf2MB ? alignment : 0;
+  void *allocation = alloc2MBAligned(allocationSize + padding);
+  FATAL_ERROR_IF(allocation == nullptr, "Allocation failed");
+  uint32_t *buffer = reinterpret_cast<uint32_t *>(
+      alignUp(reinterpret_cast<uintptr_t>(allocation), alignment));
+  team.run([&](size_t threadIndex, size_t threadsCount) {
+    const size_t chunkSize =
+        alignUp((allocationSize + threadsCount - 1) / threadsCount,
+                cacheLineSize);
+    const size_t begin = std::min(threadIndex * chunkSize, allocationSize);
+    const size_t end = std::min(begin + chunkSize, allocationSize);
+    std::memset(reinterpret_cast<uint8_t *>(buffer) + begin, 0, end - begin);
+  });
+  if (arguments.pointerChase) {
+    createPointerCycle(buffer, linesCount);
+  }
+
+  // Every thread performs its part of accesses and keeps its sum in a
+  // separate cache line, so reads cannot be optimized away
+  const size_t batchesPerThread =
+      (accessesCount / team.getThreadsCount() + IndexGenerator::batchSize - 1) /
+      IndexGenerator::batchSize;
+  constexpr size_t sumStride = cacheLineSize / sizeof(uint32_t);
+  std::vector<uint32_t> sums(team.getThreadsCount() * sumStride);
+  const ThreadTeam::Job job = [&](size_t threadIndex, size_t) {
+    uint32_t sum = 0;
+    if (arguments.pointerChase) {
+      sum = chasePointers(buffer, accessesCount);
+    } else if (accessMode == AccessMode::Read) {
+      sum = accessRandomly<AccessMode::Read>(buffer, rangeElements,
+                                             batchesPerThread, threadIndex);
+    } else if (accessMode == AccessMode::Write) {
+      sum = accessRandomly<AccessMode::Write>(buffer, rangeElements,
+                                              batchesPerThread, threadIndex);
+    } else {
+      sum = accessRandomly<AccessMode::ReadWrite>(
+          buffer, rangeElements, batchesPerThread, threadIndex);
+    }
+    sums[threadIndex * sumStride] += sum;
+  };
+
+  // Warmup
+  team.run(job);
+
+  // Benchmark
+  const size_t accessesPerformed =
+      batchesPerThread * IndexGenerator::batchSize * team.getThreadsCount();
+  const size_t bytesPerAccess = accessMode == AccessMode::ReadWrite
+                                    ? sizeof(uint32_t) * 2
+                                    : sizeof(uint32_t);
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    HostCache::prepare(buffer, allocationSize);
+
+    timer.measureStart();
+    team.run(job);
+    timer.measureEnd();
+
+    if (arguments.pointerChase) {
+      statistics.pushValue(timer.get() / accessesCount, typeSelector.getUnit(),
+                           typeSelector.getType());
+    } else {
+      statistics.pushValue(timer.get(), accessesPerformed * bytesPerAccess,
+                           typeSelector.getUnit(), typeSelector.getType());
+    }
+  }
+
+  // Cleanup
+  free2MBAligned(allocation);
+
+  return TestResult::Success;
+}
+
+static RegisterTestCaseImplementation<RandomAccess> registerTestCase(run,
+                                                                     Api::CPU);
@@ -0,0 +1,409 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/cpu/cpu.h"
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/buffer_contents_helper.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/thread_team.h"
+#include "framework/utility/timer.h"
+
+#include "definitions/stream_memory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define STREAM_MEMORY_SIMD
+#endif
+
+#if defined(__GNUC__)
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+// Elements are split between threads in multiples of a cache line, so vector
+// stores of every thread are aligned and no line is shared by two threads
+constexpr static size_t elementsPerCacheLine = 64 / sizeof(double);
+constexpr static double scalarValue = 3.0;
+
+struct StreamBuffers {
+  double *a = nullptr;
+  double *b = nullptr;
+  double *c = nullptr;
+};
+
+// Scalar kernels, used for strided accesses and on hosts without AVX2
+
+static double readScalar(const double *a, size_t count, size_t stride) {
+  double sum = 0;
+  for (size_t i = 0; i < count; i++) {
+    sum += a[i * stride];
+  }
+  return sum;
+}
+
+static void writeScalar(double *a, size_t count, size_t stride) {
+  for (size_t i = 0; i < count; i++) {
+    a[i * stride] = scalarValue;
+  }
+}
+
+static void scaleScalar(double *b, const double *a, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    b[i] = scalarValue * a[i];
+  }
+}
+
+static void triadScalar(double *c, const double *a, const double *b,
+                        size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    c[i] = a[i] + scalarValue * b[i];
+  }
+}
+
+#ifdef STREAM_MEMORY_SIMD
+
+// AVX2 kernels, 4 elements per vector
+
+TARGET_AVX2 static double readAvx2(const double *a, size_t count) {
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    sum0 = _mm256_add_pd(sum0, _mm256_load_pd(a + i));
+    sum1 = _mm256_add_pd(sum1, _mm256_load_pd(a + i + 4));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+         readScalar(a + i, count - i, 1);
+}
+
+template <bool nonTemporal>
+TARGET_AVX2 static void writeAvx2(double *a, size_t count) {
+  const __m256d value = _mm256_set1_pd(scalarValue);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    if constexpr (nonTemporal) {
+      _mm256_stream_pd(a + i, value);
+    } else {
+      _mm256_store_pd(a + i, value);
+    }
+  }
+  writeScalar(a + i, count - i, 1);
+}
+
+template <bool nonTemporal>
+TARGET_AVX2 static void scaleAvx2(double *b, const double *a, size_t count) {
+  const __m256d scalar = _mm256_set1_pd(scalarValue);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d result = _mm256_mul_pd(scalar, _mm256_load_pd(a + i));
+    if constexpr (nonTemporal) {
+      _mm256_stream_pd(b + i, result);
+    } else {
+      _mm256_store_pd(b + i, result);
+    }
+  }
+  scaleScalar(b + i, a + i, count - i);
+}
+
+template <bool nonTemporal>
+TARGET_AVX2 static void triadAvx2(double *c, const double *a, const double *b,
+                                  size_t count) {
+  const __m256d scalar = _mm256_set1_pd(scalarValue);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d result = _mm256_fmadd_pd(scalar, _mm256_load_pd(b + i),
+                                           _mm256_load_pd(a + i));
+    if constexpr (nonTemporal) {
+      _mm256_stream_pd(c + i, result);
+    } else {
+      _mm256_store_pd(c + i, result);
+    }
+  }
+  triadScalar(c + i, a + i, b + i, count - i);
+}
+
+// AVX-512 kernels, 8 elements per vector
+
+TARGET_AVX512 static double readAvx512(const double *a, size_t count) {
+  __m512d sum0 = _mm512_setzero_pd();
+  __m512d sum1 = _mm512_setzero_pd();
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16) {
+    sum0 = _mm512_add_pd(sum0, _mm512_load_pd(a + i));
+    sum1 = _mm512_add_pd(sum1, _mm512_load_pd(a + i + 8));
+  }
+  double lanes[8];
+  _mm512_storeu_pd(lanes, _mm512_add_pd(sum0, sum1));
+  return readScalar(lanes, 8, 1) + readScalar(a + i, count - i, 1);
+}
+
+template <bool nonTemporal>
+TARGET_AVX512 static void writeAvx512(double *a, size_t count) {
+  const __m512d value = _mm512_set1_pd(scalarValue);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    if constexpr (nonTemporal) {
+      _mm512_stream_pd(a + i, value);
+    } else {
+      _mm512_store_pd(a + i, value);
+    }
+  }
+  writeScalar(a + i, count - i, 1);
+}
+
+template <bool nonTemporal>
+TARGET_AVX512 static void scaleAvx512(double *b, const double *a,
+                                      size_t count) {
+  const __m512d scalar = _mm512_set1_pd(scalarValue);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d result = _mm512_mul_pd(scalar, _mm512_load_pd(a + i));
+    if constexpr (nonTemporal) {
+      _mm512_stream_pd(b + i, result);
+    } else {
+      _mm512_store_pd(b + i, result);
+    }
+  }
+  scaleScalar(b + i, a + i, count - i);
+}
+
+template <bool nonTemporal>
+TARGET_AVX512 static void triadAvx512(double *c, const double *a,
+                                      const double *b, size_t count) {
+  const __m512d scalar = _mm512_set1_pd(scalarValue);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d result = _mm512_fmadd_pd(scalar, _mm512_load_pd(b + i),
+                                           _mm512_load_pd(a + i));
+    if constexpr (nonTemporal) {
+      _mm512_stream_pd(c + i, result);
+    } else {
+      _mm512_store_pd(c + i, result);
+    }
+  }
+  triadScalar(c + i, a + i, b + i, count - i);
+}
+
+#endif // STREAM_MEMORY_SIMD
+
+// Streams elements [begin, begin + count) of the buffers and returns the sum
+// of read elements, so reads cannot be optimized away
+template <bool nonTemporal>
+static double streamChunk(StreamMemoryType type, CPU::SimdLevel simdLevel,
+                          const StreamBuffers &buffers, size_t begin,
+                          size_t count) {
+  double *a = buffers.a + begin;
+  double *b = buffers.b != nullptr ? buffers.b + begin : nullptr;
+  double *c = buffers.c != nullptr ? buffers.c + begin : nullptr;
+
+#ifdef STREAM_MEMORY_SIMD
+  if (simdLevel == CPU::SimdLevel::Avx512) {
+    switch (type) {
+    case StreamMemoryType::Read:
+      return readAvx512(a, count);
+    case StreamMemoryType::Write:
+      writeAvx512<nonTemporal>(a, count);
+      return 0;
+    case StreamMemoryType::Scale:
+      scaleAvx512<nonTemporal>(b, a, count);
+      return 0;
+    case StreamMemoryType::Triad:
+      triadAvx512<nonTemporal>(c, a, b, count);
+      return 0;
+    default:
+      FATAL_ERROR("Unknown StreamMemoryType");
+    }
+  }
+  if (simdLevel == CPU::SimdLevel::Avx2) {
+    switch (type) {
+    case StreamMemoryType::Read:
+      return readAvx2(a, count);
+    case StreamMemoryType::Write:
+      writeAvx2<nonTemporal>(a, count);
+      return 0;
+    case StreamMemoryType::Scale:
+      scaleAvx2<nonTemporal>(b, a, count);
+      return 0;
+    case StreamMemoryType::Triad:
+      triadAvx2<nonTemporal>(c, a, b, count);
+      return 0;
+    default:
+      FATAL_ERROR("Unknown StreamMemoryType");
+    }
+  }
+#endif // STREAM_MEMORY_SIMD
+
+  switch (type) {
+  case StreamMemoryType::Read:
+    return readScalar(a, count, 1);
+  case StreamMemoryType::Write:
+    writeScalar(a, count, 1);
+    return 0;
+  case StreamMemoryType::Scale:
+    scaleScalar(b, a, count);
+    return 0;
+  case StreamMemoryType::Triad:
+    triadScalar(c, a, b, count);
+    return 0;
+  default:
+    FATAL_ERROR("Unknown StreamMemoryType");
+  }
+}
+
+static void getThreadRange(size_t count, size_t threadIndex,
+                           size_t threadsCount, size_t &begin, size_t &end) {
+  const size_t elementsPerThread =
+      alignUp((count + threadsCount - 1) / threadsCount, elementsPerCacheLine);
+  begin = std::min(threadIndex * elementsPerThread, count);
+  end = std::min(begin + elementsPerThread, count);
+}
+
+static TestResult run(const StreamMemoryArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::GigabytesPerSecond,
+                                 MeasurementType::Cpu);
+
+  if (arguments.useEvents ||
+      arguments.memoryPlacement != UsmMemoryPlacement::Host) {
+    return TestResult::NoImplementation;
+  }
+  if (arguments.partialMultiplier > 1u &&
+      (arguments.type == StreamMemoryType::Scale ||
+       arguments.type == StreamMemoryType::Triad || arguments.nonTemporal)) {
+    return TestResult::NoImplementation;
+  }
+  if (arguments.nonTemporal && arguments.type == StreamMemoryType::Read) {
+    return TestResult::NoImplementation;
+  }
+  if (arguments.size % sizeof(double) != 0) {
+    return TestResult::InvalidArgs;
+  }
+
+  const CPU::SimdLevel simdLevel = CPU::getSimdLevel();
+  if (arguments.nonTemporal && simdLevel == CPU::SimdLevel::Scalar) {
+    return TestResult::DeviceNotCapable;
+  }
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  // Setup
+  ThreadTeam team{arguments.threads};
+  Timer timer;
+  const StreamMemoryType type = arguments.type;
+  const size_t multiplier = arguments.partialMultiplier;
+  const size_t bufferElements = arguments.size / sizeof(double);
+  const size_t accessedElements = bufferElements / multiplier;
+
+  // Create buffers
+  size_t buffersCount = 0;
+  switch (type) {
+  case StreamMemoryType::Read:
+  case StreamMemoryType::Write:
+    buffersCount = 1;
+    break;
+  case StreamMemoryType::Scale:
+    buffersCount = 2;
+    break;
+  case StreamMemoryType::Triad:
+    buffersCount = 3;
+    break;
+  default:
+    FATAL_ERROR("Unknown StreamMemoryType");
+  }
+  double *allocations[3] = {};
+  for (size_t i = 0; i < buffersCount; i++) {
+    allocations[i] = static_cast<double *>(alloc2MBAligned(arguments.size));
+    FATAL_ERROR_IF(allocations[i] == nullptr, "Allocation failed");
+  }
+  const StreamBuffers buffers{allocations[0], allocations[1], allocations[2]};
+
+  // Touch pages first from the threads which will stream them, so they are
+  // placed in memory local to these threads
+  team.run([&](size_t threadIndex, size_t threadsCount) {
+    size_t begin = 0;
+    size_t end = 0;
+    getThreadRange(accessedElements, threadIndex, threadsCount, begin, end);
+    begin *= multiplier;
+    end = threadIndex == threadsCount - 1 ? bufferElements : end * multiplier;
+    for (size_t i = 0; i < buffersCount; i++) {
+      std::memset(allocations[i] + begin, 0, (end - begin) * sizeof(double));
+    }
+  });
+  for (size_t i = 0; i < buffersCount; i++) {
+    BufferContentsHelper::fill(reinterpret_cast<uint8_t *>(allocations[i]),
+                               arguments.size, arguments.contents);
+  }
+
+  // Sums are kept in separate cache lines, so threads do not share them
+  std::vector<double> sums(team.getThreadsCount() * elementsPerCacheLine);
+  const ThreadTeam::Job job = [&](size_t threadIndex, size_t threadsCount) {
+    size_t begin = 0;
+    size_t end = 0;
+    getThreadRange(accessedElements, threadIndex, threadsCount, begin, end);
+    const size_t count = end - begin;
+
+    double sum = 0;
+    if (multiplier > 1) {
+      if (type == StreamMemoryType::Read) {
+        sum = readScalar(buffers.a + begin * multiplier, count, multiplier);
+      } else {
+        writeScalar(buffers.a + begin * multiplier, count, multiplier);
+      }
+    } else if (arguments.nonTemporal) {
+      sum = streamChunk<true>(type, simdLevel, buffers, begin, count);
+#ifdef STREAM_MEMORY_SIMD
+      // Make non-temporal stores visible before the run is finished
+      _mm_sfence();
+#endif
+    } else {
+      sum = streamChunk<false>(type, simdLevel, buffers, begin, count);
+    }
+    sums[threadIndex * elementsPerCacheLine] += sum;
+  };
+
+  // Warmup
+  team.run(job);
+
+  // Benchmark
+  const size_t transferSize = accessedElements * sizeof(double) * buffersCount;
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    for (size_t buffer = 0; buffer < buffersCount; buffer++) {
+      HostCache::prepare(allocations[buffer], arguments.size);
+    }
+
+    timer.measureStart();
+    team.run(job);
+    timer.measureEnd();
+
+    statistics.pushValue(timer.get(), transferSize, typeSelector.getUnit(),
+                         typeSelector.getType());
+  }
+
+  // Cleanup
+  for (size_t i = 0; i < buffersCount; i++) {
+    free2MBAligned(allocations[i]);
+  }
+
+  return TestResult::Success;
+}
+
+static RegisterTestCaseImplementation<StreamMemory> registerTestCase(run,
+                                                                     Api::CPU);
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/host_allocator.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/staging_pipeline.h"
+#include "framework/utility/thread_team.h"
+#include "framework/utility/timer.h"
+
+#include "definitions/usm_copy_staging_buffers.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+// There is no device, so its memory and copy engine are emulated with a host
+// buffer and a thread doing memcpy. This measures the pipeline itself, i.e.
+// how well host copies of consecutive chunks overlap with engine copies.
+static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::GigabytesPerSecond,
+                                 MeasurementType::Cpu);
+
+  if (arguments.forceBlitter) {
+    return TestResult::NoImplementation;
+  }
+  if (arguments.dstPlacement != UsmMemoryPlacement::Device &&
+      arguments.dstPlacement != UsmMemoryPlacement::Host) {
+    return TestResult::InvalidArgs;
+  }
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  // Without pipelining every chunk has its own staging buffer and is copied
+  // by the calling thread alone, as in the L0 implementation
+  const bool pipelined = arguments.depth > 0;
+  const size_t size = arguments.size;
+  const size_t chunkSize = (size + arguments.chunks - 1) / arguments.chunks;
+  const size_t stagingBuffersCount =
+      pipelined ? static_cast<size_t>(arguments.depth)
+                : static_cast<size_t>(arguments.chunks);
+
+  // Create buffers
+  Timer timer;
+  auto hostBuffer = HostAllocator::allocateArray<uint8_t>(size);
+  auto deviceBuffer = HostAllocator::allocateArray<uint8_t>(size);
+  FATAL_ERROR_IF(hostBuffer == nullptr || deviceBuffer == nullptr,
+                 "Allocation failed");
+  std::memset(hostBuffer.get(), 0, size);
+  std::memset(deviceBuffer.get(), 0, size);
+  std::vector<std::unique_ptr<uint8_t[], HostAllocator::Deleter>> staging{};
+  std::vector<void *> stagingBuffers{};
+  for (auto i = 0u; i < stagingBuffersCount; i++) {
+    staging.push_back(HostAllocator::allocateArray<uint8_t>(chunkSize));
+    FATAL_ERROR_IF(staging.back() == nullptr, "Allocation failed");
+    std::memset(staging.back().get(), 0, chunkSize);
+    stagingBuffers.push_back(staging.back().get());
+  }
+
+  // Create pipeline
+  const auto direction = arguments.dstPlacement == UsmMemoryPlacement::Device
+                             ? StagingPipeline::Direction::ToDevice
+                             : StagingPipeline::Direction::FromDevice;
+  ThreadTeam hostThreads{pipelined ? static_cast<size_t>(arguments.hostThreads)
+                                   : 1u};
+  ThreadCopyEngine copyEngine{deviceBuffer.get(), stagingBuffers};
+  StagingPipeline pipeline{copyEngine, hostThreads, stagingBuffers, pipelined};
+
+  // Warmup
+  pipeline.transfer(direction, hostBuffer.get(), size, chunkSize);
+
+  // Benchmark
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    HostCache::prepare(hostBuffer.get(), size);
+    for (auto stagingBuffer : stagingBuffers) {
+      HostCache::prepare(stagingBuffer, chunkSize);
+    }
+
+    timer.measureStart();
+    pipeline.transfer(direction, hostBuffer.get(), size, chunkSize);
+    timer.measureEnd();
+    statistics.pushValue(timer.get(), size, typeSelector.getUnit(),
+                         typeSelector.getType());
+  }
+
+  return TestResult::Success;
+}
+
+static RegisterTestCaseImplementation<UsmCopyStagingBuffers>
+    registerTestCase(run, Api::CPU);
@@ -1,13 +1,13 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/module_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
 #include "framework/utility/memory_constants.h"
 #include "framework/utility/timer.h"
 
@@ -39,6 +39,10 @@ static TestResult run(const RandomAccessArguments &arguments,
   MeasurementFields typeSelector(MeasurementUnit::Microseconds,
                                  MeasurementType::Cpu);
 
+  if (arguments.pointerChase) {
+    return TestResult::NoImplementation;
+  }
+
   if (isNoopRun()) {
     statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
     return TestResult::Nooped;
@@ -115,18 +119,12 @@ static TestResult run(const RandomAccessArguments &arguments,
   }
 
   // Create kernel
-  const auto kernelBinary =
-      FileHelper::loadBinaryFile("access_device_mem_random.spv");
-  if (kernelBinary.size() == 0) {
-    return TestResult::KernelNotFound;
-  }
-  ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
-  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
-  moduleDesc.inputSize = kernelBinary.size();
-  moduleDesc.pInputModule = kernelBinary.data();
   ze_module_handle_t module{};
-  ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device,
-                                          &moduleDesc, &module, nullptr));
+  if (auto result = ModuleHelperL0::createModuleFromSpirvFile(
+          levelzero, "access_device_mem_random.spv", nullptr, module);
+      result != TestResult::Success) {
+    return result;
+  }
   ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
   kernelDesc.flags = ZE_KERNEL_FLAG_EXPLICIT_RESIDENCY;
   kernelDesc.pKernelName = "access_device_memory_random";
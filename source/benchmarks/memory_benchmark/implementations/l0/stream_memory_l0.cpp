@@ -7,9 +7,9 @@
 
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/buffer_contents_helper_l0.h"
+#include "framework/l0/utility/module_helper_l0.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
 #include "framework/utility/memory_constants.h"
 #include "framework/utility/timer.h"
 
@@ -25,7 +25,12 @@ static TestResult run(const StreamMemoryArguments &arguments,
                                  arguments.useEvents ? MeasurementType::Gpu
                                                      : MeasurementType::Cpu);
 
-  if (arguments.partialMultiplier > 1u) {
+  if (arguments.partialMultiplier > 1u || arguments.nonTemporal) {
+    return TestResult::NoImplementation;
+  }
+  if (arguments.type == StreamMemoryType::Write &&
+      arguments.contents != BufferContents::Zeros &&
+      arguments.contents != BufferContents::Random) {
     return TestResult::NoImplementation;
   }
 
@@ -62,19 +67,13 @@ static TestResult run(const StreamMemoryArguments &arguments,
   const char *kernelFile = useDoubles
                                ? "memory_benchmark_stream_memory_fp64.spv"
                                : "memory_benchmark_stream_memory.spv";
-  auto spirvModule = FileHelper::loadBinaryFile(kernelFile);
-  if (spirvModule.size() == 0) {
-    return TestResult::KernelNotFound;
-  }
   ze_module_handle_t module;
   ze_kernel_handle_t kernel;
-  ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
-  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
-  moduleDesc.pInputModule =
-      reinterpret_cast<const uint8_t *>(spirvModule.data());
-  moduleDesc.inputSize = spirvModule.size();
-  ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device,
-                                          &moduleDesc, &module, nullptr));
+  if (auto result = ModuleHelperL0::createModuleFromSpirvFile(
+          levelzero, kernelFile, nullptr, module);
+      result != TestResult::Success) {
+    return result;
+  }
 
   // Create buffers
   size_t bufferSize = arguments.size;
@@ -9,6 +9,7 @@
 #include "framework/l0/utility/buffer_contents_helper_l0.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
+#include "framework/utility/host_cache.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_copy.h"
@@ -101,6 +102,12 @@ static TestResult run(const UsmCopyArguments &arguments,
 
   // Benchmark
   for (auto i = 0u; i < arguments.iterations; i++) {
+    if (isHostMemoryType(arguments.sourcePlacement)) {
+      HostCache::prepare(source, arguments.size);
+    }
+    if (isHostMemoryType(arguments.destinationPlacement)) {
+      HostCache::prepare(destination, arguments.size);
+    }
 
     timer.measureStart();
     if (!arguments.reuseCommandList) {
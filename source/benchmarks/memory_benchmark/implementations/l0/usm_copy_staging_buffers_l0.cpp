@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,13 +9,50 @@
 #include "framework/l0/utility/buffer_contents_helper_l0.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
+#include "framework/utility/host_cache.h"
 #include "framework/utility/memory_constants.h"
+#include "framework/utility/staging_pipeline.h"
+#include "framework/utility/thread_team.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_copy_staging_buffers.h"
 
 #include <gtest/gtest.h>
 
+// Every staging buffer has its own event, so the pipeline can refill it as
+// soon as the copy engine is done with it
+class CopyEngineL0 : public StagingPipeline::CopyEngine {
+public:
+  CopyEngineL0(ze_command_list_handle_t cmdList, char *deviceBuffer,
+               const std::vector<void *> &stagingBuffers,
+               const std::vector<ze_event_handle_t> &events)
+      : cmdList(cmdList), deviceBuffer(deviceBuffer),
+        stagingBuffers(stagingBuffers), events(events) {}
+
+  void submit(StagingPipeline::Direction direction, size_t stagingIndex,
+              size_t offset, size_t size) override {
+    void *dst = deviceBuffer + offset;
+    void *src = stagingBuffers[stagingIndex];
+    if (direction == StagingPipeline::Direction::FromDevice) {
+      std::swap(dst, src);
+    }
+    ZE_RESULT_SUCCESS_OR_ERROR(zeCommandListAppendMemoryCopy(
+        cmdList, dst, src, size, events[stagingIndex], 0, nullptr));
+  }
+
+  void wait(size_t stagingIndex) override {
+    ZE_RESULT_SUCCESS_OR_ERROR(zeEventHostSynchronize(
+        events[stagingIndex], std::numeric_limits<uint64_t>::max()));
+    ZE_RESULT_SUCCESS_OR_ERROR(zeEventHostReset(events[stagingIndex]));
+  }
+
+private:
+  const ze_command_list_handle_t cmdList;
+  char *const deviceBuffer;
+  const std::vector<void *> &stagingBuffers;
+  const std::vector<ze_event_handle_t> &events;
+};
+
 static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
                       Statistics &statistics) {
   MeasurementFields typeSelector(MeasurementUnit::GigabytesPerSecond,
@@ -47,6 +84,13 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
   char *src{};
   char *dst{};
   size_t offset = arguments.size / arguments.chunks;
+  const bool pipelined = arguments.depth > 0;
+  const size_t stagingBuffersCount =
+      pipelined ? static_cast<size_t>(arguments.depth)
+                : static_cast<size_t>(arguments.chunks);
+  if (pipelined) {
+    offset = (arguments.size + arguments.chunks - 1) / arguments.chunks;
+  }
 
   if (arguments.dstPlacement == UsmMemoryPlacement::Device) {
     ASSERT_ZE_RESULT_SUCCESS(
@@ -63,8 +107,8 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
   }
 
   // create staging buffers
-  std::vector<void *> usmHost(arguments.chunks);
-  for (auto i = 0u; i < arguments.chunks; i++) {
+  std::vector<void *> usmHost(stagingBuffersCount);
+  for (auto i = 0u; i < stagingBuffersCount; i++) {
     ASSERT_ZE_RESULT_SUCCESS(UsmHelper::allocate(
         UsmMemoryPlacement::Host, levelzero, offset, &usmHost[i]));
   }
@@ -76,10 +120,12 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
         levelzero, src, arguments.size, BufferContents::Zeros, false));
   }
 
-  // Create events
+  // Create events, one for the barrier and one per staging buffer when
+  // pipelined
+  const size_t eventsCount = 1 + (pipelined ? stagingBuffersCount : 0);
   ze_event_pool_desc_t eventPoolDesc{ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
   eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
-  eventPoolDesc.count = 1;
+  eventPoolDesc.count = static_cast<uint32_t>(eventsCount);
 
   ze_event_pool_handle_t eventPool;
   ze_event_handle_t event{};
@@ -89,6 +135,12 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
                                ZE_EVENT_SCOPE_FLAG_DEVICE,
                                ZE_EVENT_SCOPE_FLAG_HOST};
   ASSERT_ZE_RESULT_SUCCESS(zeEventCreate(eventPool, &eventDesc, &event));
+  std::vector<ze_event_handle_t> stagingEvents(eventsCount - 1);
+  for (auto i = 0u; i < stagingEvents.size(); i++) {
+    eventDesc.index = i + 1;
+    ASSERT_ZE_RESULT_SUCCESS(
+        zeEventCreate(eventPool, &eventDesc, &stagingEvents[i]));
+  }
 
   // Create command list
   auto commandQueueDesc = QueueFamiliesHelper::getPropertiesForSelectingEngine(
@@ -98,6 +150,25 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
       levelzero.context, levelzero.commandQueueDevice, &commandQueueDesc->desc,
       &cmdList));
 
+  // Create pipeline
+  const auto direction = arguments.dstPlacement == UsmMemoryPlacement::Device
+                             ? StagingPipeline::Direction::ToDevice
+                             : StagingPipeline::Direction::FromDevice;
+  char *deviceBuffer = direction == StagingPipeline::Direction::ToDevice
+                           ? dst
+                           : src;
+  char *hostBuffer = direction == StagingPipeline::Direction::ToDevice
+                         ? src
+                         : dst;
+  CopyEngineL0 copyEngine{cmdList, deviceBuffer, usmHost, stagingEvents};
+  std::unique_ptr<ThreadTeam> hostThreads{};
+  std::unique_ptr<StagingPipeline> pipeline{};
+  if (pipelined) {
+    hostThreads = std::make_unique<ThreadTeam>(arguments.hostThreads);
+    pipeline = std::make_unique<StagingPipeline>(copyEngine, *hostThreads,
+                                                 usmHost, true);
+  }
+
   // Warmup
   if (arguments.dstPlacement == UsmMemoryPlacement::Device) {
     ASSERT_ZE_RESULT_SUCCESS(zeCommandListAppendMemoryCopy(
@@ -114,6 +185,20 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
 
   // Benchmark
   for (auto i = 0u; i < arguments.iterations; i++) {
+    HostCache::prepare(hostBuffer, arguments.size);
+    for (auto stagingBuffer : usmHost) {
+      HostCache::prepare(stagingBuffer, offset);
+    }
+
+    if (pipelined) {
+      timer.measureStart();
+      pipeline->transfer(direction, hostBuffer, arguments.size, offset);
+      timer.measureEnd();
+      statistics.pushValue(timer.get(), arguments.size,
+                           typeSelector.getUnit(), typeSelector.getType());
+      continue;
+    }
+
     timer.measureStart();
     for (auto j = 0u; j < arguments.chunks; j++) {
       if (arguments.dstPlacement == UsmMemoryPlacement::Device) {
@@ -146,6 +231,9 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
   }
 
   // Cleanup
+  for (auto stagingEvent : stagingEvents) {
+    ASSERT_ZE_RESULT_SUCCESS(zeEventDestroy(stagingEvent));
+  }
   ASSERT_ZE_RESULT_SUCCESS(zeEventDestroy(event));
   ASSERT_ZE_RESULT_SUCCESS(zeEventPoolDestroy(eventPool));
   ASSERT_ZE_RESULT_SUCCESS(zeCommandListDestroy(cmdList));
@@ -157,7 +245,7 @@ static TestResult run(const UsmCopyStagingBuffersArguments &arguments,
         UsmHelper::deallocate(UsmMemoryPlacement::Device, levelzero, src));
   }
 
-  for (auto i = 0u; i < arguments.chunks; i++) {
+  for (auto i = 0u; i < stagingBuffersCount; i++) {
     ASSERT_ZE_RESULT_SUCCESS(
         UsmHelper::deallocate(UsmMemoryPlacement::Host, levelzero, usmHost[i]));
   }
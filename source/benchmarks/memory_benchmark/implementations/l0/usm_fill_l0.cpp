@@ -71,10 +71,8 @@ static TestResult run(const UsmFillArguments &arguments,
 
   // Create pattern
   const auto pattern = std::make_unique<uint8_t[]>(arguments.patternSize);
-  if (arguments.patternContents == BufferContents::Random) {
-    BufferContentsHelperL0::fillWithRandomBytes(pattern.get(),
-                                                arguments.patternSize);
-  }
+  BufferContentsHelperL0::fill(pattern.get(), arguments.patternSize,
+                               arguments.patternContents);
   if (requiresImport(arguments.usmMemoryPlacement)) {
     ASSERT_ZE_RESULT_SUCCESS(levelzero.importHostPointer.importExternalPointer(
         levelzero.driver, pattern.get(), arguments.patternSize));
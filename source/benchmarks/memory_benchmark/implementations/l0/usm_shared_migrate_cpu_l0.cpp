@@ -1,13 +1,13 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/module_helper_l0.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_shared_migrate_cpu.h"
@@ -40,18 +40,12 @@ static TestResult run(const UsmSharedMigrateCpuArguments &arguments,
   const size_t elementsCount = arguments.bufferSize / sizeof(uint32_t);
 
   // Create kernel
-  const auto kernelBinary =
-      FileHelper::loadBinaryFile("memory_benchmark_fill_with_ones.spv");
-  if (kernelBinary.size() == 0) {
-    return TestResult::KernelNotFound;
-  }
-  ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
-  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
-  moduleDesc.inputSize = kernelBinary.size();
-  moduleDesc.pInputModule = kernelBinary.data();
   ze_module_handle_t module{};
-  ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device,
-                                          &moduleDesc, &module, nullptr));
+  if (auto result = ModuleHelperL0::createModuleFromSpirvFile(
+          levelzero, "memory_benchmark_fill_with_ones.spv", nullptr, module);
+      result != TestResult::Success) {
+    return result;
+  }
   ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
   kernelDesc.flags = ZE_KERNEL_FLAG_EXPLICIT_RESIDENCY;
   kernelDesc.pKernelName = "fill_with_ones";
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "framework/ocl/utility/hostptr_reuse_helper.h"
 #include "framework/ocl/utility/profiling_helper.h"
 #include "framework/test_case/register_test_case.h"
+#include "framework/utility/host_cache.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/read_buffer.h"
@@ -68,6 +69,8 @@ static TestResult run(const ReadBufferArguments &arguments,
 
   // Benchmark
   for (auto i = 0u; i < arguments.iterations; i++) {
+    HostCache::prepare(hostptrAlloc.ptr, arguments.size);
+
     ASSERT_CL_SUCCESS(BufferContentsHelperOcl::fillBuffer(
         opencl.commandQueue, buffer, arguments.size, arguments.contents));
 
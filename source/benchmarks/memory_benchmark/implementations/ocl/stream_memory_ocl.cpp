@@ -26,6 +26,15 @@ static TestResult run(const StreamMemoryArguments &arguments,
                                  arguments.useEvents ? MeasurementType::Gpu
                                                      : MeasurementType::Cpu);
 
+  if (arguments.nonTemporal) {
+    return TestResult::NoImplementation;
+  }
+  if (arguments.type == StreamMemoryType::Write &&
+      arguments.contents != BufferContents::Zeros &&
+      arguments.contents != BufferContents::Random) {
+    return TestResult::NoImplementation;
+  }
+
   if (arguments.partialMultiplier > 1u) {
     if (arguments.type == StreamMemoryType::Scale ||
         arguments.type == StreamMemoryType::Triad) {
@@ -10,6 +10,7 @@
 #include "framework/ocl/utility/profiling_helper.h"
 #include "framework/ocl/utility/usm_helper_ocl.h"
 #include "framework/test_case/register_test_case.h"
+#include "framework/utility/host_cache.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/usm_copy.h"
@@ -78,6 +79,12 @@ static TestResult run(const UsmCopyArguments &arguments,
 
   // Benchmark
   for (auto i = 0u; i < arguments.iterations; i++) {
+    if (isHostMemoryType(srcAlloc.placement)) {
+      HostCache::prepare(srcAlloc.ptr, arguments.size);
+    }
+    if (isHostMemoryType(dstAlloc.placement)) {
+      HostCache::prepare(dstAlloc.ptr, arguments.size);
+    }
 
     cl_event profilingEvent{};
     cl_event *eventForEnqueue = arguments.useEvents ? &profilingEvent : nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,10 +55,8 @@ static TestResult run(const UsmFillArguments &arguments,
 
   // Create pattern
   const auto pattern = std::make_unique<uint8_t[]>(arguments.patternSize);
-  if (arguments.patternContents == BufferContents::Random) {
-    BufferContentsHelperOcl::fillWithRandomBytes(pattern.get(),
-                                                 arguments.patternSize);
-  }
+  BufferContentsHelperOcl::fill(pattern.get(), arguments.patternSize,
+                                arguments.patternContents);
 
   // Warmup
   ASSERT_CL_SUCCESS(clEnqueueMemFillINTEL(
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "framework/ocl/utility/hostptr_reuse_helper.h"
 #include "framework/ocl/utility/profiling_helper.h"
 #include "framework/test_case/register_test_case.h"
+#include "framework/utility/host_cache.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/write_buffer.h"
@@ -70,6 +71,7 @@ static TestResult run(const WriteBufferArguments &arguments,
 
   // Benchmark
   for (auto i = 0u; i < arguments.iterations; i++) {
+    HostCache::prepare(hostptrAlloc.ptr, arguments.size);
 
     cl_event profilingEvent{};
     cl_event *eventForEnqueue = arguments.useEvents ? &profilingEvent : nullptr;
@@ -201,6 +201,10 @@ static TestResult run(const StreamMemoryArguments &arguments,
                                  arguments.useEvents ? MeasurementType::Gpu
                                                      : MeasurementType::Cpu);
 
+  if (arguments.nonTemporal) {
+    return TestResult::NoImplementation;
+  }
+
   if (isNoopRun()) {
     statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
     return TestResult::Nooped;
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/basic_argument.h"
+#include "framework/test_case/test_case.h"
+
+struct IpcHandleExchangeArguments : TestCaseArgumentContainer {
+  PositiveIntegerArgument numberOfProcesses;
+  PositiveIntegerArgument handlesPerProcess;
+
+  IpcHandleExchangeArguments()
+      : numberOfProcesses(*this, "numberOfProcesses",
+                          "Total number of processes"),
+        handlesPerProcess(*this, "handlesPerProcess",
+                          "Number of file descriptors published by each "
+                          "process") {}
+};
+
+struct IpcHandleExchange : TestCase<IpcHandleExchangeArguments> {
+  using TestCase<IpcHandleExchangeArguments>::TestCase;
+
+  std::string getTestCaseName() const override { return "IpcHandleExchange"; }
+
+  std::string getHelp() const override {
+    return "Measures time of an all-to-all exchange of file descriptors "
+           "between processes through a shared-memory directory and one "
+           "batched SCM_RIGHTS message per pair of processes. Plain memfd "
+           "descriptors stand in for IPC handles of device allocations and "
+           "their contents are verified. Linux-only.";
+  }
+};
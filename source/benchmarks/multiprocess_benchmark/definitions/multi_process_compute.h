@@ -44,6 +44,7 @@ struct MultiProcessCompute : TestCase<MultiProcessComputeArguments> {
            "compute workload and measures average time to complete all of "
            "them. Processes "
            "will use affinity mask to select specific sub-devices for the "
-           "execution";
+           "execution. \"launch\" and \"ready\" report the cost of starting "
+           "the processes.";
   }
 };
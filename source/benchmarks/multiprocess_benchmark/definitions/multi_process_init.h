@@ -31,6 +31,7 @@ struct MultiProcessInit : TestCase<MultiProcessInitArguments> {
     return "Measures the initialization overhead in a multi-process "
            "application."
            "For Level Zero we only measure the first invocation of zeInit() "
-           "per process execution.";
+           "per process execution. \"launch\" and \"ready\" report the "
+           "cost of starting the processes.";
   }
 };
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/enum/process_launcher_argument.h"
+#include "framework/test_case/test_case.h"
+
+struct ProcessLaunchArguments : TestCaseArgumentContainer {
+  PositiveIntegerArgument numberOfProcesses;
+  ProcessLauncherArgument launcher;
+  ByteSizeArgument hostAllocationSize;
+
+  ProcessLaunchArguments()
+      : numberOfProcesses(*this, "numberOfProcesses",
+                          "Total number of processes"),
+        launcher(*this, "launcher",
+                 "Mechanism used for spawning child processes"),
+        hostAllocationSize(*this, "hostAllocationSize",
+                           "Size of host memory touched by the parent process "
+                           "before launching children") {}
+};
+
+struct ProcessLaunch : TestCase<ProcessLaunchArguments> {
+  using TestCase<ProcessLaunchArguments>::TestCase;
+
+  std::string getTestCaseName() const override { return "ProcessLaunch"; }
+
+  std::string getHelp() const override {
+    return "Measures time needed to launch a group of empty workloads. Parent "
+           "process touches a host allocation of given size first, to "
+           "simulate a large address space, which makes fork() slower. "
+           "\"launch\" is the time spent in the parent creating all "
+           "processes and \"ready\" is the time until all processes have "
+           "reported to the parent.";
+  }
+};
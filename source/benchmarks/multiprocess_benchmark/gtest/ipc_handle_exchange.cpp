@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "definitions/ipc_handle_exchange.h"
+
+#include "framework/test_case/register_test_case.h"
+
+#include <gtest/gtest.h>
+
+[[maybe_unused]] static const inline RegisterTestCase<IpcHandleExchange>
+    registerTestCase{};
+
+class IpcHandleExchangeTest
+    : public ::testing::TestWithParam<std::tuple<uint32_t, uint32_t>> {};
+
+TEST_P(IpcHandleExchangeTest, Test) {
+  IpcHandleExchangeArguments args{};
+  args.api = Api::CPU;
+  args.numberOfProcesses = std::get<0>(GetParam());
+  args.handlesPerProcess = std::get<1>(GetParam());
+
+  IpcHandleExchange test;
+  test.run(args);
+}
+
+INSTANTIATE_TEST_SUITE_P(IpcHandleExchangeTest, IpcHandleExchangeTest,
+                         ::testing::Combine(::testing::Values(2, 8, 32),
+                                            ::testing::Values(1, 6, 64)));
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "definitions/process_launch.h"
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/memory_constants.h"
+
+#include <gtest/gtest.h>
+
+[[maybe_unused]] static const inline RegisterTestCase<ProcessLaunch>
+    registerTestCase{};
+
+class ProcessLaunchTest
+    : public ::testing::TestWithParam<
+          std::tuple<uint32_t, ProcessLauncher, size_t>> {};
+
+TEST_P(ProcessLaunchTest, Test) {
+  ProcessLaunchArguments args{};
+  args.api = Api::CPU;
+  args.numberOfProcesses = std::get<0>(GetParam());
+  args.launcher = std::get<1>(GetParam());
+  args.hostAllocationSize = std::get<2>(GetParam());
+
+  ProcessLaunch test;
+  test.run(args);
+}
+
+using namespace MemoryConstants;
+INSTANTIATE_TEST_SUITE_P(
+    ProcessLaunchTest, ProcessLaunchTest,
+    ::testing::Combine(::testing::Values(1, 8, 32, 64),
+                       ::testing::Values(ProcessLauncher::Fork,
+                                         ProcessLauncher::PosixSpawn),
+                       ::testing::Values(1 * megaByte, 1 * gigaByte)));
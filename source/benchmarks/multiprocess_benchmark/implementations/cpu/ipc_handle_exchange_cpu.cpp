@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/process_group.h"
+
+#include "definitions/ipc_handle_exchange.h"
+
+#include <gtest/gtest.h>
+
+#ifdef WIN32
+
+static TestResult run(const IpcHandleExchangeArguments &, Statistics &) {
+  return TestResult::NoImplementation;
+}
+
+#else // WIN32
+
+#include "framework/utility/linux/ipc_rendezvous.h"
+
+static TestResult run(const IpcHandleExchangeArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::Microseconds,
+                                 MeasurementType::Cpu);
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  if (arguments.handlesPerProcess > IpcRendezvous::maxSlotsCount) {
+    return TestResult::InvalidArgs;
+  }
+
+  // Children perform the exchange among themselves, parent only creates the
+  // shared directory
+  IpcRendezvous rendezvous{static_cast<uint32_t>(arguments.numberOfProcesses),
+                           static_cast<uint32_t>(arguments.handlesPerProcess)};
+
+  ProcessGroup processes{"ipc_rendezvous_workload_cpu",
+                         arguments.numberOfProcesses};
+  processes.addArgumentAll("iterations", std::to_string(arguments.iterations));
+  processes.addArgumentAll("rendezvousFd",
+                           std::to_string(rendezvous.getDirectoryFd()));
+  for (auto i = 0u; i < processes.size(); i++) {
+    processes[i].addHandleForInheritance(rendezvous.getDirectoryFd());
+    processes[i].addArgument("rank", std::to_string(i));
+    processes[i].setName("Process #" + std::to_string(i));
+  }
+
+  processes.runAll();
+  processes.waitForFinishAll();
+  TestResult result = processes.getResultAll();
+  if (result != TestResult::Success) {
+    return result;
+  }
+
+  const bool pushIndividualProcessesMeasurements = (processes.size() > 1);
+  processes.pushMeasurementsToStatistics(
+      arguments.iterations, statistics, typeSelector.getUnit(),
+      typeSelector.getType(), pushIndividualProcessesMeasurements, true);
+
+  return TestResult::Success;
+}
+
+#endif // WIN32
+
+static RegisterTestCaseImplementation<IpcHandleExchange>
+    registerTestCase(run, Api::CPU);
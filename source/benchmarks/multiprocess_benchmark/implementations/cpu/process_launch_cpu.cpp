@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/process_group.h"
+
+#include "definitions/process_launch.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+
+static TestResult run(const ProcessLaunchArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::Microseconds,
+                                 MeasurementType::Cpu);
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  // Touch all pages, so they are present in page tables of the parent
+  auto hostAllocation =
+      std::make_unique<uint8_t[]>(arguments.hostAllocationSize);
+  std::memset(hostAllocation.get(), 1, arguments.hostAllocationSize);
+
+  // Benchmark
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    ProcessGroup processes{"empty_workload_cpu", arguments.numberOfProcesses};
+    processes.setLauncherAll(arguments.launcher);
+    processes.addArgumentAll("iterations", "1");
+    processes.addArgumentAll("synchronize", "0");
+
+    processes.runAll();
+    processes.waitForReadyAll();
+    processes.waitForFinishAll();
+    TestResult result = processes.getResultAll();
+    if (result != TestResult::Success) {
+      return result;
+    }
+
+    statistics.pushValue(processes.getLaunchTime(), typeSelector.getUnit(),
+                         typeSelector.getType(), "launch");
+    statistics.pushValue(processes.getTimeToReadyAll(), typeSelector.getUnit(),
+                         typeSelector.getType(), "ready");
+  }
+
+  return TestResult::Success;
+}
+
+static RegisterTestCaseImplementation<ProcessLaunch>
+    registerTestCase(run, Api::CPU);
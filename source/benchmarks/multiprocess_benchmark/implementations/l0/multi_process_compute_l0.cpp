@@ -64,6 +64,7 @@ static TestResult run(const MultiProcessComputeArguments &arguments,
 
   // Run processes
   processes.runAll();
+  processes.waitForReadyAll();
   if (arguments.synchronize) {
     processes.synchronizeAll(arguments.iterations);
   }
@@ -77,6 +78,11 @@ static TestResult run(const MultiProcessComputeArguments &arguments,
       arguments.iterations, statistics, typeSelector.getUnit(),
       typeSelector.getType(), pushIndividualProcessesMeasurements, true);
 
+  // Cost of starting the processes is reported apart from the steady state
+  processes.pushReadinessToStatistics(statistics, typeSelector.getUnit(),
+                                      typeSelector.getType(),
+                                      pushIndividualProcessesMeasurements);
+
   return TestResult::Success;
 }
 
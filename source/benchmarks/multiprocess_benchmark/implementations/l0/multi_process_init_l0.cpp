@@ -26,6 +26,7 @@ static TestResult run(const MultiProcessInitArguments &arguments,
   }
 
   processes.runAll();
+  processes.waitForReadyAll();
   processes.synchronizeAll(arguments.iterations);
   processes.waitForFinishAll();
 
@@ -39,6 +40,11 @@ static TestResult run(const MultiProcessInitArguments &arguments,
       arguments.iterations, statistics, typeSelector.getUnit(),
       typeSelector.getType(), pushIndividualProcessesMeasurements, true);
 
+  // Cost of starting the processes is reported apart from the steady state
+  processes.pushReadinessToStatistics(statistics, typeSelector.getUnit(),
+                                      typeSelector.getType(),
+                                      pushIndividualProcessesMeasurements);
+
   return TestResult::Success;
 }
 
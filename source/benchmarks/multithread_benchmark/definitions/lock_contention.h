@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/basic_argument.h"
+#include "framework/argument/enum/lock_type_argument.h"
+#include "framework/test_case/test_case.h"
+
+struct LockContentionArguments : TestCaseArgumentContainer {
+  LockTypeArgument lockType;
+  PositiveIntegerArgument threads;
+  PositiveIntegerArgument acquisitions;
+  NonNegativeIntegerArgument criticalSection;
+  NonNegativeIntegerArgument delay;
+  NonNegativeIntegerArgument writePercent;
+
+  LockContentionArguments()
+      : lockType(*this, "lockType", "Lock guarding the shared data"),
+        threads(*this, "threads", "Number of threads contending for the lock"),
+        acquisitions(*this, "acquisitions",
+                     "Number of acquisitions by each thread per iteration"),
+        criticalSection(*this, "criticalSection",
+                        "Number of shared cache lines accessed while holding "
+                        "the lock"),
+        delay(*this, "delay",
+              "Number of thread-local operations between acquisitions"),
+        writePercent(*this, "writePercent",
+                     "Percentage of SharedMutex acquisitions which are "
+                     "exclusive, the rest are shared. Other locks are always "
+                     "exclusive") {}
+};
+
+struct LockContention : TestCase<LockContentionArguments> {
+  using TestCase<LockContentionArguments>::TestCase;
+
+  std::string getTestCaseName() const override { return "LockContention"; }
+
+  std::string getHelp() const override {
+    return "Measures cost of a lock when a number of threads repeatedly "
+           "acquire it to access shared data. \"p50\", \"p99\" and \"p99.9\" "
+           "are percentiles of time from requesting the lock to owning it, "
+           "gathered from all acquisitions of all threads. \"per "
+           "acquisition\" is the total time divided by the number of "
+           "acquisitions, i.e. the inverse of throughput. Exclusive "
+           "acquisitions increment all shared cache lines and shared ones "
+           "read them. Spinning locks degrade sharply when there are more "
+           "threads than cores.";
+  }
+};
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "definitions/lock_contention.h"
+
+#include "framework/test_case/register_test_case.h"
+
+#include <gtest/gtest.h>
+
+[[maybe_unused]] static const inline RegisterTestCase<LockContention>
+    registerTestCase{};
+
+class LockContentionTest
+    : public ::testing::TestWithParam<
+          std::tuple<LockType, size_t, size_t, size_t, size_t>> {};
+
+TEST_P(LockContentionTest, Test) {
+  LockContentionArguments args{};
+  args.api = Api::CPU;
+  args.lockType = std::get<0>(GetParam());
+  args.threads = std::get<1>(GetParam());
+  args.acquisitions = 10000;
+  args.criticalSection = std::get<2>(GetParam());
+  args.delay = std::get<3>(GetParam());
+  args.writePercent = std::get<4>(GetParam());
+
+  LockContention test;
+  test.run(args);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    LockContentionTest, LockContentionTest,
+    ::testing::Combine(::testing::Values(LockType::StdMutex, LockType::Spinlock,
+                                         LockType::TicketLock, LockType::McsLock,
+                                         LockType::FutexMutex),
+                       ::testing::Values(1u, 2u, 4u, 8u, 16u),
+                       ::testing::Values(1u, 8u),
+                       ::testing::Values(0u, 100u),
+                       ::testing::Values(100u)));
+
+INSTANTIATE_TEST_SUITE_P(
+    LockContentionSharedMutexTest, LockContentionTest,
+    ::testing::Combine(::testing::Values(LockType::SharedMutex),
+                       ::testing::Values(1u, 2u, 4u, 8u, 16u),
+                       ::testing::Values(1u, 8u),
+                       ::testing::Values(0u, 100u),
+                       ::testing::Values(0u, 10u, 100u)));
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/test_case/register_test_case.h"
+#include "framework/utility/thread_team.h"
+
+#include "definitions/lock_contention.h"
+#include "utility/locks.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <vector>
+
+using Clock = std::chrono::high_resolution_clock;
+
+// Only std::shared_mutex distinguishes shared acquisitions
+template <typename Lock>
+struct LockOperations {
+  static void lock(Lock &mutex, bool) { mutex.lock(); }
+  static void unlock(Lock &mutex, bool) { mutex.unlock(); }
+};
+
+template <>
+struct LockOperations<std::shared_mutex> {
+  static void lock(std::shared_mutex &mutex, bool exclusive) {
+    if (exclusive) {
+      mutex.lock();
+    } else {
+      mutex.lock_shared();
+    }
+  }
+  static void unlock(std::shared_mutex &mutex, bool exclusive) {
+    if (exclusive) {
+      mutex.unlock();
+    } else {
+      mutex.unlock_shared();
+    }
+  }
+};
+
+struct alignas(lockCacheLineSize) SharedLine {
+  uint64_t value = 0;
+};
+
+struct alignas(lockCacheLineSize) ThreadResults {
+  std::vector<Clock::duration> latencies = {};
+  uint64_t sink = 0;
+};
+
+// Exclusive acquisitions are spread evenly, so there are exactly
+// acquisitions * writePercent / 100 of them
+static bool isExclusive(size_t acquisitionIndex, size_t writePercent) {
+  return (acquisitionIndex + 1) * writePercent / 100 !=
+         acquisitionIndex * writePercent / 100;
+}
+
+// Thread-local work between acquisitions, which cannot be optimized away
+static uint64_t doLocalWork(uint64_t state, size_t operationsCount) {
+  for (size_t i = 0; i < operationsCount; i++) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+  }
+  return state;
+}
+
+static Clock::duration getPercentile(std::vector<Clock::duration> &latencies,
+                                     size_t permille) {
+  const size_t index =
+      std::min(latencies.size() * permille / 1000, latencies.size() - 1);
+  std::nth_element(latencies.begin(), latencies.begin() + index,
+                   latencies.end());
+  return latencies[index];
+}
+
+template <typename Lock>
+static TestResult runWithLock(const LockContentionArguments &arguments,
+                              Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::Nanoseconds,
+                                 MeasurementType::Cpu);
+
+  // Setup
+  constexpr bool isSharedLock = std::is_same_v<Lock, std::shared_mutex>;
+  const size_t writePercent = isSharedLock ? arguments.writePercent : 100;
+  const size_t acquisitionsCount = arguments.acquisitions;
+  ThreadTeam team{arguments.threads};
+  Lock lock{};
+  std::vector<SharedLine> sharedLines(arguments.criticalSection);
+  std::vector<ThreadResults> threadsResults(team.getThreadsCount());
+  for (auto &results : threadsResults) {
+    results.latencies.reserve(acquisitionsCount);
+  }
+
+  // Threads are woken up one by one, so they wait for each other before
+  // contending for the lock
+  std::atomic<size_t> arrivedCount{0};
+  Clock::time_point startTime{};
+  const ThreadTeam::Job job = [&](size_t threadIndex, size_t threadsCount) {
+    ThreadResults &results = threadsResults[threadIndex];
+    results.latencies.clear();
+    uint64_t localState = threadIndex;
+
+    arrivedCount.fetch_add(1, std::memory_order_acq_rel);
+    while (arrivedCount.load(std::memory_order_acquire) != threadsCount) {
+      _mm_pause();
+    }
+    if (threadIndex == 0) {
+      startTime = Clock::now();
+    }
+
+    for (size_t i = 0; i < acquisitionsCount; i++) {
+      const bool exclusive = isExclusive(i, writePercent);
+      const auto requestTime = Clock::now();
+      LockOperations<Lock>::lock(lock, exclusive);
+      const auto acquireTime = Clock::now();
+      if (exclusive) {
+        for (auto &line : sharedLines) {
+          line.value++;
+        }
+      } else {
+        for (const auto &line : sharedLines) {
+          localState += line.value;
+        }
+      }
+      LockOperations<Lock>::unlock(lock, exclusive);
+
+      results.latencies.push_back(acquireTime - requestTime);
+      localState = doLocalWork(localState, arguments.delay);
+    }
+    results.sink += localState;
+  };
+
+  // Warmup
+  team.run(job);
+  arrivedCount = 0;
+
+  // Benchmark
+  const size_t totalAcquisitions = acquisitionsCount * team.getThreadsCount();
+  std::vector<Clock::duration> latencies;
+  latencies.reserve(totalAcquisitions);
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    team.run(job);
+    const auto endTime = Clock::now();
+    arrivedCount = 0;
+
+    latencies.clear();
+    for (const auto &results : threadsResults) {
+      latencies.insert(latencies.end(), results.latencies.begin(),
+                       results.latencies.end());
+    }
+    statistics.pushValue(getPercentile(latencies, 500), typeSelector.getUnit(),
+                         typeSelector.getType(), "p50");
+    statistics.pushValue(getPercentile(latencies, 990), typeSelector.getUnit(),
+                         typeSelector.getType(), "p99");
+    statistics.pushValue(getPercentile(latencies, 999), typeSelector.getUnit(),
+                         typeSelector.getType(), "p99.9");
+    statistics.pushValue((endTime - startTime) / totalAcquisitions,
+                         typeSelector.getUnit(), typeSelector.getType(),
+                         "per acquisition");
+  }
+
+  // Verify every exclusive acquisition was alone in the critical section
+  size_t exclusiveCount = 0;
+  for (size_t i = 0; i < acquisitionsCount; i++) {
+    exclusiveCount += isExclusive(i, writePercent) ? 1 : 0;
+  }
+  const uint64_t expectedValue =
+      exclusiveCount * team.getThreadsCount() * (arguments.iterations + 1);
+  for (const auto &line : sharedLines) {
+    if (line.value != expectedValue) {
+      return TestResult::VerificationFail;
+    }
+  }
+
+  return TestResult::Success;
+}
+
+static TestResult run(const LockContentionArguments &arguments,
+                      Statistics &statistics) {
+  MeasurementFields typeSelector(MeasurementUnit::Nanoseconds,
+                                 MeasurementType::Cpu);
+
+  if (arguments.writePercent > 100) {
+    return TestResult::InvalidArgs;
+  }
+
+  if (isNoopRun()) {
+    statistics.pushUnitAndType(typeSelector.getUnit(), typeSelector.getType());
+    return TestResult::Nooped;
+  }
+
+  switch (arguments.lockType) {
+  case LockType::StdMutex:
+    return runWithLock<std::mutex>(arguments, statistics);
+  case LockType::SharedMutex:
+    return runWithLock<std::shared_mutex>(arguments, statistics);
+  case LockType::Spinlock:
+    return runWithLock<Spinlock>(arguments, statistics);
+  case LockType::TicketLock:
+    return runWithLock<TicketLock>(arguments, statistics);
+  case LockType::McsLock:
+    return runWithLock<McsLock>(arguments, statistics);
+  case LockType::FutexMutex:
+    return runWithLock<FutexMutex>(arguments, statistics);
+  default:
+    return TestResult::InvalidArgs;
+  }
+}
+
+static RegisterTestCaseImplementation<LockContention>
+    registerTestCase(run, Api::CPU);
@@ -9,6 +9,7 @@
 #include "framework/l0/levelzero.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
+#include "framework/utility/cpu_placement.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/immediate_cmdlist_completion.h"
@@ -25,6 +26,7 @@ struct ThreadSpecificData {
   void *deviceDstMemory{};
   uint32_t maxMemoryAllocSize{};
   Timer timer{};
+  CpuPlacementSlot cpuPlacement{};
 };
 
 struct EngineInfo {
@@ -34,6 +36,7 @@ struct EngineInfo {
 
 static void issueToImmediateCmdList(ThreadSpecificData *threadData,
                                     std::shared_mutex *barrier) {
+  CpuPlacement::pinCurrentThread(threadData->cpuPlacement);
   std::shared_lock sharedLock(*barrier);
   threadData->timer.measureStart();
   EXPECT_ZE_RESULT_SUCCESS(zeCommandListAppendMemoryCopy(
@@ -151,6 +154,9 @@ static TestResult run(const ImmediateCommandListCompletionArguments &arguments,
     ASSERT_ZE_RESULT_SUCCESS(UsmHelper::allocate(UsmMemoryPlacement::Host,
                                                  levelzero, arguments.copySize,
                                                  &threadData[i].hostSrcMemory));
+    threadData[i].cpuPlacement = CpuPlacement::getSlot(i);
+    CpuPlacement::bindMemory(threadData[i].hostSrcMemory, arguments.copySize,
+                             threadData[i].cpuPlacement);
     ASSERT_ZE_RESULT_SUCCESS(UsmHelper::allocate(
         UsmMemoryPlacement::Device, levelzero, arguments.copySize,
         &threadData[i].deviceDstMemory));
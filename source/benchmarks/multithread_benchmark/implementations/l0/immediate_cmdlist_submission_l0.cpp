@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,10 @@
 
 #include "framework/enum/engine.h"
 #include "framework/l0/levelzero.h"
+#include "framework/l0/utility/module_helper_l0.h"
 #include "framework/l0/utility/usm_helper.h"
 #include "framework/test_case/register_test_case.h"
-#include "framework/utility/file_helper.h"
+#include "framework/utility/cpu_placement.h"
 #include "framework/utility/timer.h"
 
 #include "definitions/immediate_cmdlist_submission.h"
@@ -24,6 +25,7 @@ struct ThreadSpecificData {
   ze_event_handle_t event{};
   void *hostMemory = nullptr;
   Timer timer{};
+  CpuPlacementSlot cpuPlacement{};
   ze_kernel_handle_t kernel{};
 };
 
@@ -34,6 +36,7 @@ struct EngineInfo {
 
 static void issueToImmediateCmdList(ThreadSpecificData *threadData,
                                     std::shared_mutex *barrier) {
+  CpuPlacement::pinCurrentThread(threadData->cpuPlacement);
   const ze_group_count_t groupCount{1, 1, 1};
   volatile uint64_t *volatileBuffer =
       static_cast<uint64_t *>(threadData->hostMemory);
@@ -122,18 +125,12 @@ static TestResult run(const ImmediateCommandListSubmissionArguments &arguments,
   const size_t bufferSize = 4096u;
 
   // Create kernel
-  const auto kernelBinary =
-      FileHelper::loadBinaryFile("ulls_benchmark_write_one.spv");
-  if (kernelBinary.size() == 0) {
-    return TestResult::KernelNotFound;
-  }
-  ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
-  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
-  moduleDesc.inputSize = kernelBinary.size();
-  moduleDesc.pInputModule = kernelBinary.data();
   ze_module_handle_t module{};
-  ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, levelzero.device,
-                                          &moduleDesc, &module, nullptr));
+  if (auto result = ModuleHelperL0::createModuleFromSpirvFile(
+          levelzero, "ulls_benchmark_write_one.spv", nullptr, module);
+      result != TestResult::Success) {
+    return result;
+  }
   ze_kernel_desc_t kernelDesc{ZE_STRUCTURE_TYPE_KERNEL_DESC};
   kernelDesc.flags = ZE_KERNEL_FLAG_EXPLICIT_RESIDENCY;
   kernelDesc.pKernelName = "write_one";
@@ -147,6 +144,9 @@ static TestResult run(const ImmediateCommandListSubmissionArguments &arguments,
     ASSERT_ZE_RESULT_SUCCESS(UsmHelper::allocate(UsmMemoryPlacement::Host,
                                                  levelzero, bufferSize,
                                                  &threadData[i].hostMemory));
+    threadData[i].cpuPlacement = CpuPlacement::getSlot(i);
+    CpuPlacement::bindMemory(threadData[i].hostMemory, bufferSize,
+                             threadData[i].cpuPlacement);
     ASSERT_ZE_RESULT_SUCCESS(
         zeContextMakeMemoryResident(levelzero.context, levelzero.device,
                                     threadData[i].hostMemory, bufferSize));
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/utility/futex.h"
+
+#include <atomic>
+#include <cstdint>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+// Locks compared against std::mutex by LockContention. All of them meet the
+// Lockable requirements, so they work with std::lock_guard. Fields touched by
+// different threads are kept in separate cache lines.
+constexpr static size_t lockCacheLineSize = 64;
+
+// Test-and-test-and-set spinlock. Waiters spin on a plain load, so the cache
+// line is only written when the lock looks free.
+class Spinlock {
+public:
+  void lock() {
+    while (locked.exchange(true, std::memory_order_acquire)) {
+      while (locked.load(std::memory_order_relaxed)) {
+        _mm_pause();
+      }
+    }
+  }
+
+  void unlock() { locked.store(false, std::memory_order_release); }
+
+private:
+  alignas(lockCacheLineSize) std::atomic<bool> locked{false};
+};
+
+// FIFO spinlock. Each waiter takes a ticket and spins until it is served.
+class TicketLock {
+public:
+  void lock() {
+    const uint32_t ticket = nextTicket.fetch_add(1, std::memory_order_relaxed);
+    while (servedTicket.load(std::memory_order_acquire) != ticket) {
+      _mm_pause();
+    }
+  }
+
+  void unlock() {
+    const uint32_t ticket = servedTicket.load(std::memory_order_relaxed);
+    servedTicket.store(ticket + 1, std::memory_order_release);
+  }
+
+private:
+  alignas(lockCacheLineSize) std::atomic<uint32_t> nextTicket{0};
+  alignas(lockCacheLineSize) std::atomic<uint32_t> servedTicket{0};
+};
+
+// Queue lock of Mellor-Crummey and Scott. Waiters form a linked list and each
+// of them spins on its own node, so a release invalidates the cache of one
+// waiter only. Nodes belong to threads, so a thread cannot hold two McsLocks
+// at the same time.
+class McsLock {
+public:
+  void lock() {
+    Node &node = getNode();
+    node.next.store(nullptr, std::memory_order_relaxed);
+    node.locked.store(true, std::memory_order_relaxed);
+
+    Node *predecessor = tail.exchange(&node, std::memory_order_acq_rel);
+    if (predecessor != nullptr) {
+      predecessor->next.store(&node, std::memory_order_release);
+      while (node.locked.load(std::memory_order_acquire)) {
+        _mm_pause();
+      }
+    }
+  }
+
+  void unlock() {
+    Node &node = getNode();
+    Node *successor = node.next.load(std::memory_order_acquire);
+    if (successor == nullptr) {
+      Node *expected = &node;
+      if (tail.compare_exchange_strong(expected, nullptr,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+        return;
+      }
+
+      // Another thread has swapped the tail, but not linked itself yet
+      while ((successor = node.next.load(std::memory_order_acquire)) ==
+             nullptr) {
+        _mm_pause();
+      }
+    }
+    successor->locked.store(false, std::memory_order_release);
+  }
+
+private:
+  struct alignas(lockCacheLineSize) Node {
+    std::atomic<Node *> next{nullptr};
+    std::atomic<bool> locked{false};
+  };
+
+  static Node &getNode() {
+    thread_local Node node{};
+    return node;
+  }
+
+  alignas(lockCacheLineSize) std::atomic<Node *> tail{nullptr};
+};
+
+// Mutex sleeping in the kernel when contended, as described in "Futexes Are
+// Tricky" by Ulrich Drepper. The kernel is entered only if there may be
+// waiters, which is what the third state tracks.
+class FutexMutex {
+public:
+  void lock() {
+    uint32_t state = unlocked;
+    if (word.compare_exchange_strong(state, locked, std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      return;
+    }
+    if (state != contended) {
+      state = word.exchange(contended, std::memory_order_acquire);
+    }
+    while (state != unlocked) {
+      Futex::wait(word, contended);
+      state = word.exchange(contended, std::memory_order_acquire);
+    }
+  }
+
+  void unlock() {
+    if (word.exchange(unlocked, std::memory_order_release) == contended) {
+      Futex::wakeOne(word);
+    }
+  }
+
+private:
+  constexpr static uint32_t unlocked = 0;
+  constexpr static uint32_t locked = 1;
+  constexpr static uint32_t contended = 2;
+
+  alignas(lockCacheLineSize) std::atomic<uint32_t> word{unlocked};
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "framework/argument/argument_container.h"
 #include "framework/argument/string_argument.h"
+#include "framework/configuration.h"
 #include "framework/utility/command_line_argument.h"
 #include "framework/utility/file_helper.h"
 #include "framework/utility/process.h"
@@ -36,6 +37,10 @@ int main(int argc, char **argv) {
   StringArgument fileName{arguments, "fileName"};
   arguments.parseArguments(commandLineArguments);
 
+  // Benchmarks are launched with Process, which reads how to launch them from
+  // the configuration
+  Configuration::loadDefaultConfiguration();
+
   // Full names and paths of benchmarks are known by CMake and passed via a
   // preprocessor definition.
   const BenchmarkInstance benchmarkInstances[] = {TARGETS};
@@ -150,8 +155,8 @@ int main(int argc, char **argv) {
 
       outputFile << "# " << benchmark.baseName << '\n';
       outputFile << benchmark.description << '\n';
-      outputFile << "| Test name | Description | Params | L0 | OCL |\n";
-      outputFile << "|-----------|-------------|--------|----|-----|\n";
+      outputFile << "| Test name | Description | Params | L0 | OCL | CPU |\n";
+      outputFile << "|-----------|-------------|--------|----|-----|-----|\n";
       for (const auto &entry : benchmark.testCases) {
         const TestCase &testCase = entry.second;
 
@@ -173,6 +178,10 @@ int main(int argc, char **argv) {
                            ? ":heavy_check_mark:"
                            : ":x:")
                    << '|';
+        outputFile << (testCase.apis.find(Api::CPU) != testCase.apis.end()
+                           ? ":heavy_check_mark:"
+                           : ":x:")
+                   << '|';
         outputFile << '\n';
       }
       outputFile << "\n\n\n";
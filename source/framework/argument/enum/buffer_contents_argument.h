@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,8 @@ struct BufferContentsArgument
 
   const static inline std::string enumName = "buffer contents";
   const static inline EnumType invalidEnumValue = EnumType::Unknown;
-  const static inline EnumType enumValues[2] = {EnumType::Zeros,
-                                                EnumType::Random};
-  const static inline std::string enumValuesNames[2] = {"Zeros", "Random"};
+  const static inline EnumType enumValues[4] = {
+      EnumType::Zeros, EnumType::Random, EnumType::Runs, EnumType::Entropy};
+  const static inline std::string enumValuesNames[4] = {"Zeros", "Random",
+                                                        "Runs", "Entropy"};
 };
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/cpu_placement_policy.h"
+
+struct CpuPlacementPolicyArgument
+    : EnumArgument<CpuPlacementPolicyArgument, CpuPlacementPolicy> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "cpu placement policy";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[5] = {
+      EnumType::None, EnumType::Compact, EnumType::Scatter, EnumType::NumaNode,
+      EnumType::Explicit};
+  const static inline std::string enumValuesNames[5] = {
+      "None", "Compact", "Scatter", "NumaNode", "Explicit"};
+};
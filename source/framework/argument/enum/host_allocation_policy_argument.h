@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/host_allocation_policy.h"
+
+struct HostAllocationPolicyArgument
+    : EnumArgument<HostAllocationPolicyArgument, HostAllocationPolicy> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "host allocation policy";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[5] = {
+      EnumType::Default, EnumType::SmallPages, EnumType::TransparentHugePages,
+      EnumType::HugeTlb2M, EnumType::HugeTlb1G};
+  const static inline std::string enumValuesNames[5] = {
+      "Default", "4K", "THP", "HugeTlb2M", "HugeTlb1G"};
+};
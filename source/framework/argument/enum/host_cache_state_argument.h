@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/host_cache_state.h"
+
+struct HostCacheStateArgument
+    : EnumArgument<HostCacheStateArgument, HostCacheState> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "host cache state";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[4] = {
+      EnumType::Unchanged, EnumType::Cold, EnumType::LlcResident,
+      EnumType::L1Resident};
+  const static inline std::string enumValuesNames[4] = {"Unchanged", "Cold",
+                                                        "LLC", "L1"};
+};
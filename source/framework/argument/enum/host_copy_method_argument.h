@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/host_copy_method.h"
+
+struct HostCopyMethodArgument
+    : EnumArgument<HostCopyMethodArgument, HostCopyMethod> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "host copy method";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[6] = {
+      EnumType::Memcpy,          EnumType::RepMovsb,
+      EnumType::Avx2,            EnumType::Avx2NonTemporal,
+      EnumType::Avx512,          EnumType::Avx512NonTemporal};
+  const static inline std::string enumValuesNames[6] = {
+      "Memcpy", "RepMovsb", "Avx2", "Avx2NT", "Avx512", "Avx512NT"};
+};
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/lock_type.h"
+
+struct LockTypeArgument : EnumArgument<LockTypeArgument, LockType> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "lock type";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[6] = {
+      EnumType::StdMutex,   EnumType::SharedMutex, EnumType::Spinlock,
+      EnumType::TicketLock, EnumType::McsLock,     EnumType::FutexMutex};
+  const static inline std::string enumValuesNames[6] = {
+      "StdMutex", "SharedMutex", "Spinlock", "Ticket", "Mcs", "Futex"};
+};
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/page_population.h"
+
+struct PagePopulationArgument
+    : EnumArgument<PagePopulationArgument, PagePopulation> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "page population";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[5] = {
+      EnumType::Touch, EnumType::MapPopulate, EnumType::WillNeed,
+      EnumType::PopulateWrite, EnumType::Userfaultfd};
+  const static inline std::string enumValuesNames[5] = {
+      "Touch", "MapPopulate", "WillNeed", "PopulateWrite", "Userfaultfd"};
+};
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/process_launcher.h"
+
+struct ProcessLauncherArgument
+    : EnumArgument<ProcessLauncherArgument, ProcessLauncher> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "process launcher";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[2] = {EnumType::Fork,
+                                                EnumType::PosixSpawn};
+  const static inline std::string enumValuesNames[2] = {"Fork", "PosixSpawn"};
+};
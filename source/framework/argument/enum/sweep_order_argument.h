@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/argument/abstract/enum_argument.h"
+#include "framework/enum/sweep_order.h"
+
+struct SweepOrderArgument : EnumArgument<SweepOrderArgument, SweepOrder> {
+  using EnumArgument::EnumArgument;
+  ThisType &operator=(EnumType newValue) {
+    this->value = newValue;
+    markAsParsed();
+    return *this;
+  }
+
+  const static inline std::string enumName = "sweep order";
+  const static inline EnumType invalidEnumValue = EnumType::Unknown;
+  const static inline EnumType enumValues[2] = {EnumType::Nested,
+                                                EnumType::Random};
+  const static inline std::string enumValuesNames[2] = {"Nested", "Random"};
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,15 +9,29 @@
 
 #include "framework/benchmark_info.h"
 #include "framework/configuration.h"
+#include "framework/execution_plan.h"
 #include "framework/gtest_event_listener.h"
+#include "framework/interleaved_execution.h"
 #include "framework/print_device_info.h"
+#include "framework/sharded_execution.h"
 #include "framework/test_map.h"
+#include "framework/utility/checkpoint_journal.h"
 #include "framework/utility/common_help_message.h"
+#include "framework/utility/context_cache.h"
+#include "framework/utility/file_helper.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/module_cache.h"
+#include "framework/utility/process_group.h"
 #include "framework/utility/string_utils.h"
 #include "framework/utility/working_directory_helper.h"
+#include "framework/workload/workload_argument_container.h"
 
+#include <fstream>
 #include <gtest/gtest.h>
+#include <iomanip>
 #include <iostream>
+#include <random>
+#include <unordered_map>
 
 int BenchmarkMain::printVersion(bool enableWarning, const char *prefix) {
   if (!benchmarkVersion.empty()) {
@@ -98,6 +112,36 @@ int BenchmarkMain::generateDocs() {
   return 0;
 }
 
+void BenchmarkMain::printContextCacheStatistics() {
+  const ContextCacheBase::Statistics &statistics =
+      ContextCacheBase::getStatistics();
+  const auto savedTime =
+      std::chrono::duration<double, std::milli>(statistics.savedTime);
+  std::cout << "\nContexts were reused " << statistics.hits
+            << " times and created " << statistics.misses
+            << " times. Reusing saved " << std::fixed << std::setprecision(1)
+            << savedTime.count() << " ms of setup\n";
+}
+
+void BenchmarkMain::printModuleCacheStatistics() {
+  const ModuleCache &cache = ModuleCache::get();
+  const ModuleCache::Statistics &statistics = cache.getStatistics();
+  std::cout << "\nKernels were loaded from the module cache "
+            << statistics.memoryHits << " times from memory and "
+            << statistics.diskHits << " times from disk, and built "
+            << statistics.misses << " times. Binaries kept in memory take "
+            << cache.getMemoryUsage() << " bytes\n";
+}
+
+void BenchmarkMain::printJournalStatistics() {
+  const CheckpointJournal &journal = CheckpointJournal::get();
+  std::cout << "\n" << journal.getResumedCount()
+            << " configs were not executed, because they finished in a "
+               "previous run, and "
+            << journal.getCrashedCount() << " because they crashed "
+            << CheckpointJournal::maxCrashesCount << " times\n";
+}
+
 BenchmarkMain::BenchmarkMain(int argc, char **argv,
                              const std::string benchmarkVersion)
     : argc(argc), argv(argv), benchmarkVersion(benchmarkVersion) {}
@@ -112,20 +156,101 @@ int BenchmarkMain::executeSingleTest(const std::string &testName) {
 
   TestCaseInterface *testCase = it->second.get();
   replaceGtestListener<SingleTestGtestListener>();
-  if (!testCase->runFromCommandLine(commandLineArguments)) {
+  if (!testCase->runFromCommandLine(commandLineArguments,
+                                    !Configuration::get().noColumnNames)) {
     std::cerr << "Error parsing command line\n";
     return 1;
   }
   return 0;
 }
 
+int BenchmarkMain::executePlan(const std::string &planFilePath) {
+  if (const auto unprocessedArgs =
+          CommandLineArgument::getUnprocessedArguments(commandLineArguments);
+      !unprocessedArgs.empty()) {
+    const auto getKey =
+        +[](const CommandLineArgument *a) { return a->getKey(); };
+    std::cerr << CommonHelpMessage::errorIgnoredCommandLineArgs()
+              << joinStrings(", ", unprocessedArgs, getKey) << std::endl;
+    return 1;
+  }
+
+  ExecutionPlan plan{};
+  std::string errorMessage{};
+  if (!ExecutionPlan::load(planFilePath, plan, errorMessage)) {
+    std::cerr << errorMessage << std::endl;
+    return 1;
+  }
+
+  // Arguments are marked as processed while being parsed, so every use of an
+  // entry gets its own copy of them
+  const auto getEntryArguments = [](const ExecutionPlan::Entry &entry,
+                                    CommandLineArguments &outArguments) {
+    std::string parsingErrors{};
+    if (!CommandLineArgument::parseArguments(entry.arguments, outArguments,
+                                             parsingErrors)) {
+      std::cerr << parsingErrors << std::endl;
+      return false;
+    }
+    return true;
+  };
+
+  // Validate all entries up front, so a mistake at the end of a long plan is
+  // not found after all preceding tests were executed
+  const auto &testMap = TestMap::get();
+  bool valid = true;
+  for (const ExecutionPlan::Entry &entry : plan.getEntries()) {
+    auto it = testMap.find(entry.testName);
+    bool entryValid = it != testMap.end();
+    if (!entryValid) {
+      std::cerr << "Unknown test case " << entry.testName << '\n';
+    } else {
+      CommandLineArguments entryArguments{};
+      entryValid = getEntryArguments(entry, entryArguments) &&
+                   it->second->validateFromCommandLine(entryArguments);
+    }
+    if (!entryValid) {
+      std::cerr << "Error in line " << entry.lineNumber << " of plan file\n";
+      valid = false;
+    }
+  }
+  if (!valid) {
+    return 1;
+  }
+
+  // Execute entries one after another, with a single header for all of them
+  replaceGtestListener<SingleTestGtestListener>();
+  if (!Configuration::get().noColumnNames) {
+    TestCaseStatistics::printStatisticsHeader(Configuration::get().printType);
+  }
+  for (const ExecutionPlan::Entry &entry : plan.getEntries()) {
+    CommandLineArguments entryArguments{};
+    getEntryArguments(entry, entryArguments);
+    testMap.at(entry.testName)->runFromCommandLine(entryArguments, false);
+  }
+  return 0;
+}
+
 int BenchmarkMain::executeAllTests() {
+  const Configuration &configuration = Configuration::get();
   for (auto &commandLineArgument : commandLineArguments) {
     if (commandLineArgument.getKey().find("gtest_") == 0) {
       commandLineArgument.markAsProcessed();
     }
   }
 
+  // Worker processes of --shards are launched by the Process layer, which
+  // passes its own arguments to them
+  const std::string shardOutput = configuration.shardOutput;
+  if (!shardOutput.empty()) {
+    WorkloadArgumentContainer processArguments{};
+    for (auto &commandLineArgument : commandLineArguments) {
+      if (!commandLineArgument.isProcessed()) {
+        processArguments.parseArgument(commandLineArgument);
+      }
+    }
+  }
+
   if (const auto unprocessedArgs =
           CommandLineArgument::getUnprocessedArguments(commandLineArguments);
       !unprocessedArgs.empty()) {
@@ -136,26 +261,229 @@ int BenchmarkMain::executeAllTests() {
     return 1;
   }
 
+  if (!shardOutput.empty()) {
+    replaceGtestListener<ShardWorkerGtestListener>(shardOutput);
+    return RUN_ALL_TESTS();
+  }
+  if (configuration.shards > 0 ||
+      !static_cast<const std::string &>(configuration.devices).empty()) {
+    return executeShardedTests();
+  }
+
   replaceGtestListener<AllTestsGtestListener>();
   return RUN_ALL_TESTS();
 }
 
+int BenchmarkMain::executeShardedTests() {
+  const Configuration &configuration = Configuration::get();
+
+  // Select tests the same way as googletest does
+  const std::string filter = ::testing::GTEST_FLAG(filter);
+  const char *disabledTestFilter = "DISABLED_*:*/DISABLED_*";
+  const ::testing::UnitTest &unitTest = *::testing::UnitTest::GetInstance();
+  std::vector<std::string> testNames{};
+  for (int suiteIndex = 0; suiteIndex < unitTest.total_test_suite_count();
+       suiteIndex++) {
+    const ::testing::TestSuite &suite = *unitTest.GetTestSuite(suiteIndex);
+    for (int testIndex = 0; testIndex < suite.total_test_count(); testIndex++) {
+      const ::testing::TestInfo &test = *suite.GetTestInfo(testIndex);
+      const std::string testName =
+          std::string(test.test_case_name()) + "." + test.name();
+      const bool disabled =
+          ShardedExecution::matchesGtestFilter(test.test_case_name(),
+                                               disabledTestFilter) ||
+          ShardedExecution::matchesGtestFilter(test.name(), disabledTestFilter);
+      if ((!disabled || ::testing::GTEST_FLAG(also_run_disabled_tests)) &&
+          ShardedExecution::matchesGtestFilter(testName, filter)) {
+        testNames.push_back(testName);
+      }
+    }
+  }
+
+  // Split tests between workers. Shards without tests are not launched,
+  // because an empty filter would select all tests.
+  const std::string shardTimesPath = configuration.shardTimes;
+  ShardedExecution::Runtimes runtimes{};
+  std::string errorMessage{};
+  if (!shardTimesPath.empty() &&
+      !ShardedExecution::loadRuntimes(shardTimesPath, runtimes,
+                                      errorMessage)) {
+    std::cerr << errorMessage << std::endl;
+    return 1;
+  }
+  const std::vector<std::string> devices =
+      ShardedExecution::parseDevices(configuration.devices);
+  const size_t shardsCount =
+      configuration.shards > 0 ? configuration.shards : devices.size();
+  std::vector<ShardedExecution::Shard> shards =
+      ShardedExecution::partition(testNames, runtimes, shardsCount, devices);
+  shards.erase(std::remove_if(shards.begin(), shards.end(),
+                              [](const ShardedExecution::Shard &shard) {
+                                return shard.testNames.empty();
+                              }),
+               shards.end());
+
+  // Workers get the same arguments, except for the selection of tests, which
+  // could exceed the limit of command line length and is passed in a file
+  std::error_code error{};
+  const FileSystem::path directory =
+      FileSystem::temp_directory_path(error) /
+      ("compute_benchmarks_shards_" + std::to_string(std::random_device{}()));
+  FileSystem::create_directories(directory, error);
+  if (error) {
+    std::cerr << "Cannot create directory " << directory << " for worker "
+              << "processes" << std::endl;
+    return 1;
+  }
+  ProcessGroup workers{WorkingDirectoryHelper::getExeLocation().string(),
+                       shards.size()};
+  workers.setTimeout(std::chrono::milliseconds(0));
+  std::vector<std::string> outputFilePaths{};
+  for (auto shardIndex = 0u; shardIndex < shards.size(); shardIndex++) {
+    const ShardedExecution::Shard &shard = shards[shardIndex];
+    const std::string fileName = "shard" + std::to_string(shardIndex);
+    const std::string flagFilePath =
+        (directory / (fileName + ".flags")).string();
+    outputFilePaths.push_back((directory / (fileName + ".results")).string());
+    {
+      std::ofstream flagFile{flagFilePath};
+      flagFile << "--gtest_filter=";
+      for (auto i = 0u; i < shard.testNames.size(); i++) {
+        flagFile << (i > 0 ? ":" : "") << shard.testNames[i];
+      }
+      flagFile << '\n';
+    }
+
+    Process &worker = workers[shardIndex];
+    for (const CommandLineArgument &argument : commandLineArguments) {
+      const bool forwarded =
+          argument.getKey().find("gtest_") != 0 &&
+          !argument.isKeyEqualTo(configuration.shards.getKey()) &&
+          !argument.isKeyEqualTo(configuration.devices.getKey()) &&
+          !argument.isKeyEqualTo(configuration.shardTimes.getKey()) &&
+          !argument.isKeyEqualTo(configuration.noHeaders.getKey()) &&
+          !argument.isKeyEqualTo(configuration.noColumnNames.getKey());
+      if (forwarded) {
+        worker.addArgument(argument.getKey(), argument.getValue());
+      }
+    }
+    worker.addArgument("gtest_flagfile", flagFilePath);
+    worker.addArgument(configuration.shardOutput.getKey(),
+                       outputFilePaths.back());
+    worker.addArgument(configuration.noHeaders.getKey(), "");
+    worker.addArgument(configuration.noColumnNames.getKey(), "");
+    if (!shard.device.empty()) {
+      worker.addEnvVariable("ZE_AFFINITY_MASK", shard.device);
+      worker.setName("device " + shard.device);
+    }
+  }
+
+  if (!configuration.noHeaders &&
+      configuration.printType != Configuration::PrintType::Csv) {
+    std::cout << "Running " << configuration.iterations
+              << " iterations of each benchmark\n\n";
+    std::cout << "Running " << testNames.size() << " tests in "
+              << shards.size() << " worker processes with --"
+              << configuration.shards.getKey() << "\n";
+    for (auto shardIndex = 0u; shardIndex < shards.size(); shardIndex++) {
+      std::cout << "\tworker #" << shardIndex;
+      if (!shards[shardIndex].device.empty()) {
+        std::cout << " on device " << shards[shardIndex].device;
+      }
+      std::cout << ": " << shards[shardIndex].testNames.size() << " tests";
+      if (!runtimes.empty()) {
+        std::cout << ", about " << std::fixed << std::setprecision(1)
+                  << shards[shardIndex].expectedMilliseconds / 1000 << " s";
+      }
+      std::cout << '\n';
+    }
+    std::cout << '\n';
+  }
+  if (!configuration.noColumnNames) {
+    TestCaseStatistics::printStatisticsHeader(configuration.printType);
+  }
+  workers.runAll();
+  workers.waitForFinishAll();
+
+  // Gather results of all workers. Tests missing in the results were not
+  // executed, because their worker crashed or timed out.
+  std::unordered_map<std::string, ShardedExecution::TestRecord> records{};
+  std::unordered_map<std::string, size_t> shardOfTest{};
+  for (auto shardIndex = 0u; shardIndex < shards.size(); shardIndex++) {
+    const std::vector<uint8_t> data =
+        FileHelper::loadBinaryFile(outputFilePaths[shardIndex]);
+    std::vector<ShardedExecution::TestRecord> shardRecords{};
+    ShardedExecution::deserializeRecords(std::string(data.begin(), data.end()),
+                                         shardRecords);
+    for (ShardedExecution::TestRecord &record : shardRecords) {
+      records[record.testName] = std::move(record);
+    }
+    for (const std::string &testName : shards[shardIndex].testNames) {
+      shardOfTest[testName] = shardIndex;
+    }
+  }
+
+  // Print results in the order of a serial run, followed by failures
+  std::vector<std::pair<std::string, std::string>> failures{};
+  for (const std::string &testName : testNames) {
+    const auto record = records.find(testName);
+    if (record == records.end()) {
+      const size_t shardIndex = shardOfTest.at(testName);
+      Process &worker = workers[shardIndex];
+      std::string message = "Not executed, because worker process #" +
+                            std::to_string(shardIndex) + " ended early";
+      if (!worker.getFailureReason().empty()) {
+        message += ", " + worker.getFailureReason();
+      }
+      failures.emplace_back(testName, message + "\n");
+      continue;
+    }
+    std::cout << record->second.output;
+    if (!record->second.errors.empty()) {
+      failures.emplace_back(testName, record->second.errors);
+    }
+    runtimes[testName] = record->second.milliseconds;
+  }
+  if (!failures.empty()) {
+    std::cout << "\n";
+    for (const auto &[testName, message] : failures) {
+      std::cout << "[  FAILED  ] " << testName << '\n' << message << '\n';
+    }
+  }
+  std::cout << std::flush;
+
+  if (!shardTimesPath.empty() &&
+      !ShardedExecution::saveRuntimes(shardTimesPath, runtimes)) {
+    std::cerr << "Cannot write runtimes file \"" << shardTimesPath << "\"\n";
+  }
+  FileSystem::remove_all(directory, error);
+  return failures.empty() ? 0 : 1;
+}
+
 void BenchmarkMain::printHelp() {
   const auto filename = BenchmarkInfo::get().getBenchmarkFilename();
   // clang-format off
     std::cout << BenchmarkInfo::get().getBenchmarkDescription() << "\n"
                  "\n"
-                 "The benchmark works in two modes - all-tests mode and single-test mode. They are further described below. "
-                 "Global parameters applicable for both modes:\n"
+                 "The benchmark works in three modes - all-tests mode, single-test mode and plan mode. They are further described below. "
+                 "Global parameters applicable for all modes:\n"
                  << Configuration::get().getHelp(1u) << "\n"
                  "\n"
                  "First mode is the default and it runs all available benchmarks in many predefined configurations. Underlying test engine "
-                 "is googletest, so standard googletest arguments like --gtest_filter can be used, if necessary.\n"
+                 "is googletest, so standard googletest arguments like --gtest_filter can be used, if necessary. Tests can be split between "
+                 "parallel worker processes with --shards or --devices, e.g. one per device or tile. Their results are merged into a "
+                 "single report.\n"
                  "\n"
                  "Second mode runs one specific benchmark with custom parameter values. Running benchmarks in this fashion requires "
                  "using --test argument, along with benchmark-specific parameters. All parameters have to be specified, there are no "
                  "default values.\n"
                  "\n"
+                 "Third mode runs many benchmarks with custom parameter values in one process. Running benchmarks in this fashion "
+                 "requires using --plan argument with a path to a file. Each line of the file selects a test and all its parameters, "
+                 "either in the same way as in single-test mode or as a JSON object, e.g. {\"test\": \"TestName\", \"someParam\": 1}. "
+                 "Empty lines and lines starting with # are skipped. All lines are validated before running any test. Global parameters "
+                 "are passed on the command line and apply to all tests from the file.\n"
+                 "\n"
                  "Example invocations:\n"
                  "\t" << filename << "                                                runs all possible tests\n"
                  "\t" << filename << " --api=ocl                                      runs all possible OpenCL tests\n"
@@ -163,6 +491,10 @@ void BenchmarkMain::printHelp() {
                  "\t" << filename << " --gtest_filter=<regex>                         runs all tests matching a regular expression\n"
                  "\t" << filename << " --gtest_filter=*TestName*                      runs a test named \"TestName\" in all predefined configurations\n"
                  "\t" << filename << " --test=TestName --someParam=1 --otherParam=30  runs a test named \"TestName\" with specified parameters\n"
+                 "\t" << filename << " --plan=nightly.txt --csv                       runs all tests listed in a file and dumps results as CSV\n"
+                 "\t" << filename << " --api=cpu --shards=4                           runs all possible CPU tests in 4 worker processes\n"
+                 "\t" << filename << " --devices=0.0,0.1 --shardTimes=times.txt       runs all possible tests on two tiles in parallel\n"
+                 "\t" << filename << " --iterations=50 --rounds=5                    runs all possible tests in 5 rounds of 10 iterations in random order\n"
                  "\n"
                 "All available test cases with their parameters:\n";
   // clang-format on
@@ -234,15 +566,89 @@ int BenchmarkMain::main() {
     return printVersion(true);
   }
 
+  // Journal is loaded before starting worker processes of --shards, which
+  // append to it concurrently
+  const CheckpointJournal &journal = CheckpointJournal::get();
+
   // Run tests
   if (!Configuration::get().noHeaders) {
     DeviceInfo::printDeviceInfo();
     printVersion(false, "Benchmark version: ");
+    if (const std::string caches = HostCache::getCachesDescription();
+        !caches.empty()) {
+      std::cout << "Host caches: " << caches << "\n\n";
+    }
+    if (configuration.cpuPlacement != CpuPlacementPolicy::None) {
+      std::cout << "Host threads and processes are placed with --"
+                << configuration.cpuPlacement.toString();
+      if (configuration.cpuPlacement == CpuPlacementPolicy::Explicit) {
+        std::cout << " --" << configuration.cpuList.toString();
+      }
+      std::cout << "\n\n";
+    }
+    if (configuration.hostAllocationPolicy != HostAllocationPolicy::Default ||
+        configuration.hostNumaNode >= 0) {
+      std::cout << "Host buffers are allocated with --"
+                << configuration.hostAllocationPolicy.toString() << " --"
+                << configuration.hostNumaNode.toString() << "\n\n";
+    }
+    if (configuration.hostCacheState != HostCacheState::Unchanged) {
+      std::cout << "Host buffers are prepared with --"
+                << configuration.hostCacheState.toString()
+                << " before measured iterations\n\n";
+    }
+    if (configuration.seed >= 0) {
+      std::cout << "Buffer contents are generated with --"
+                << configuration.seed.toString() << "\n\n";
+    }
+    if (configuration.reuseContexts) {
+      std::cout << "Contexts and queues are reused between tests with --"
+                << configuration.reuseContexts.getKey() << "\n\n";
+    }
+    if (InterleavedExecution::get().isEnabled()) {
+      std::cout << "Test configs are executed in --"
+                << configuration.rounds.toString()
+                << " in a random order with --"
+                << configuration.roundsSeed.toString() << "\n\n";
+    }
+    if (journal.isEnabled()) {
+      std::cout << "Test configs are recorded in --"
+                << configuration.resume.toString() << ", "
+                << journal.getLoadedCount() << " of them have already "
+                << "finished\n\n";
+    }
   }
+  int result = 0;
   if (std::string test = configuration.test; test != "") {
-    return executeSingleTest(test);
+    result = executeSingleTest(test);
+  } else if (std::string plan = configuration.plan; plan != "") {
+    result = executePlan(plan);
   } else {
     ::testing::InitGoogleTest(&argc, argv);
-    return executeAllTests();
+    result = executeAllTests();
+  }
+
+  // Configs collected with --rounds are executed when all of them are known
+  if (InterleavedExecution &execution = InterleavedExecution::get();
+      execution.isEnabled()) {
+    execution.runAll(configuration.iterations);
+  }
+
+  // Objects kept alive with --reuseContexts are released before the compute
+  // APIs are unloaded
+  ContextCacheBase::clearAll();
+  if (configuration.reuseContexts && !configuration.noHeaders &&
+      configuration.printType != Configuration::PrintType::Csv) {
+    printContextCacheStatistics();
+  }
+  if (ModuleCache::get().isEnabled() && !configuration.noHeaders &&
+      configuration.printType != Configuration::PrintType::Csv) {
+    printModuleCacheStatistics();
+  }
+  if (journal.getResumedCount() + journal.getCrashedCount() > 0 &&
+      !configuration.noHeaders &&
+      configuration.printType != Configuration::PrintType::Csv) {
+    printJournalStatistics();
   }
+  return result;
 }
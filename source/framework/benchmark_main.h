@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,7 +27,12 @@ private:
   int printVersion(bool enableWarning, const char *prefix = "");
   void printHelp();
   int generateDocs();
+  void printContextCacheStatistics();
+  void printModuleCacheStatistics();
+  void printJournalStatistics();
 
   int executeSingleTest(const std::string &testName);
+  int executePlan(const std::string &planFilePath);
   int executeAllTests();
+  int executeShardedTests();
 };
@@ -30,6 +30,34 @@ Configuration::Configuration()
       test(*this, "test",
            "Selects particular test for execution. All arguments of the test "
            "must be provided"),
+      plan(*this, "plan",
+           "File with a list of tests and their arguments, which are "
+           "validated and then executed one after another"),
+      shards(*this, "shards",
+             "Number of worker processes running tests of all-tests mode in "
+             "parallel. Their results are merged into a single report. 0 "
+             "runs all tests in this process"),
+      devices(*this, "devices",
+              "Comma-separated list of devices assigned to worker processes "
+              "in turn, e.g. 0,1 for root devices or 0.0,0.1 for tiles. "
+              "Values are passed in ZE_AFFINITY_MASK. Implies one worker per "
+              "device, if --shards is not set"),
+      shardTimes(*this, "shardTimes",
+                 "File with runtimes of tests, which are used to balance "
+                 "worker processes. It is updated after each run"),
+      shardOutput(*this, "shardOutput",
+                  "File, to which a worker process writes results of its "
+                  "tests. Not meant to be used by humans"),
+      resume(*this, "resume",
+             "Journal file, in which every test config is recorded when it "
+             "finishes. Configs finished in a previous run with the same "
+             "journal are not executed again"),
+      rounds(*this, "rounds",
+             "Number of rounds, in which all test configs are executed. Each "
+             "round executes a part of iterations of every config in a "
+             "random order and results are printed after the last round"),
+      roundsSeed(*this, "roundsSeed",
+                 "Seed of the random order of test configs in --rounds"),
       subDeviceSelection(*this, "subDeviceSelection",
                          "Device to be used in the benchmarks. Might be "
                          "ignored by some specific tests"),
@@ -72,6 +100,60 @@ Configuration::Configuration()
       measurePower(*this, "measurePower",
                    "Measures power and energy in supported benchmarks"),
       printAllResults(*this, "printAllResults", "Prints all test results"),
+      processLauncher(*this, "processLauncher",
+                      "Mechanism used for spawning child processes in "
+                      "multi-process benchmarks. Ignored on Windows"),
+      processTimeout(*this, "processTimeout",
+                     "Time in seconds after which child processes of a test "
+                     "are killed and the test fails. 0 disables the limit. "
+                     "Ignored on Windows"),
+      processLaunchThreads(*this, "processLaunchThreads",
+                           "Number of threads creating child processes of a "
+                           "test concurrently. 0 selects it automatically. "
+                           "Ignored on Windows"),
+      cpuPlacement(*this, "cpuPlacement",
+                   "Placement of benchmark threads and child processes on "
+                   "host CPUs. Memory of pinned threads is bound to their "
+                   "NUMA node"),
+      cpuList(*this, "cpuList",
+              "CPUs used by Explicit cpuPlacement. Slots are separated by "
+              "semicolons, e.g. 0-3;8,9;12"),
+      hostAllocationPolicy(*this, "hostAllocationPolicy",
+                           "Pages backing host buffers allocated by the "
+                           "framework. Default keeps the behaviour of each "
+                           "allocation. HugeTlb pages fall back to THP when "
+                           "none are reserved"),
+      hostNumaNode(*this, "hostNumaNode",
+                   "NUMA node to which host buffers allocated by the "
+                   "framework are bound. -1 leaves the memory policy "
+                   "unchanged"),
+      hostCacheState(*this, "hostCacheState",
+                     "Cache state of host buffers before each measured "
+                     "iteration of benchmarks supporting it. Cold flushes "
+                     "them, LLC and L1 read them into the given cache level"),
+      seed(*this, "seed",
+           "Seed of randomly generated buffer contents. -1 means a different "
+           "seed in every run"),
+      contentsEntropyBits(*this, "contentsEntropyBits",
+                          "Entropy in bits per byte of Entropy buffer "
+                          "contents, from 0 to 8"),
+      contentsRunLength(*this, "contentsRunLength",
+                        "Mean length of runs of equal bytes in Runs buffer "
+                        "contents"),
+      reuseContexts(*this, "reuseContexts",
+                    "Keep contexts and queues of compute APIs alive between "
+                    "tests setting them up in the same way, instead of "
+                    "creating them for each test. Tests requiring fresh "
+                    "state still get new ones"),
+      moduleCacheSize(*this, "moduleCacheSize",
+                      "Megabytes of memory for native binaries of kernels "
+                      "built by compute APIs. Following tests create kernels "
+                      "from them without compiling again. 0 disables it"),
+      moduleCacheDir(*this, "moduleCacheDir",
+                     "Directory storing native binaries of kernels built by "
+                     "compute APIs, so they are reused by following runs. "
+                     "Relative paths start in the directory of the binary. "
+                     "Empty disables it"),
       extended(*this, "extended", "Run the benchmark with extended parameters"),
       reducedSizeCAL(*this, "reducedSizeCAL",
                      "Run benchmark with lower buffer size") {
@@ -98,6 +180,14 @@ Configuration::Configuration()
 
   // Api agnostic params
   test = "";
+  plan = "";
+  shards = 0;
+  devices = "";
+  shardTimes = "";
+  shardOutput = "";
+  resume = "";
+  rounds = 1;
+  roundsSeed = 0;
   csv = false;
   verbose = false;
   interactivePrints = false;
@@ -114,6 +204,20 @@ Configuration::Configuration()
   argFilter = std::vector<std::string>();
   testFilter = std::vector<std::string>();
   returnSubmissionTimeInsteadOfWorkloadTime = false;
+  processLauncher = ProcessLauncher::Fork;
+  processTimeout = 0;
+  processLaunchThreads = 0;
+  cpuPlacement = CpuPlacementPolicy::None;
+  cpuList = "";
+  hostAllocationPolicy = HostAllocationPolicy::Default;
+  hostNumaNode = -1;
+  hostCacheState = HostCacheState::Unchanged;
+  seed = -1;
+  contentsEntropyBits = 4;
+  contentsRunLength = 16;
+  reuseContexts = false;
+  moduleCacheSize = 0;
+  moduleCacheDir = "";
 
   // Test specific params
   extended = false;
@@ -159,9 +263,36 @@ Configuration &Configuration::get() {
   return *Configuration::instance;
 }
 
+bool Configuration::isLoaded() { return Configuration::instance != nullptr; }
+
 bool Configuration::validateArgumentsExtra() const {
   if (csv && verbose) {
     return false;
   }
+  if (!static_cast<const std::string &>(test).empty() &&
+      !static_cast<const std::string &>(plan).empty()) {
+    return false;
+  }
+  if ((shards > 0 || !static_cast<const std::string &>(devices).empty()) &&
+      (!static_cast<const std::string &>(test).empty() ||
+       !static_cast<const std::string &>(plan).empty())) {
+    return false;
+  }
+  if (rounds > 1 &&
+      (rounds > iterations || shards > 0 ||
+       !static_cast<const std::string &>(devices).empty() ||
+       !static_cast<const std::string &>(resume).empty())) {
+    return false;
+  }
+  if (cpuPlacement == CpuPlacementPolicy::Explicit &&
+      static_cast<const std::string &>(cpuList).empty()) {
+    return false;
+  }
+  if (hostNumaNode < -1 || seed < -1) {
+    return false;
+  }
+  if (contentsEntropyBits > 8) {
+    return false;
+  }
   return true;
 }
@@ -11,7 +11,11 @@
 #include "framework/argument/basic_argument.h"
 #include "framework/argument/boolean_flag_argument.h"
 #include "framework/argument/enum/api_argument.h"
+#include "framework/argument/enum/cpu_placement_policy_argument.h"
 #include "framework/argument/enum/device_selection_argument.h"
+#include "framework/argument/enum/host_allocation_policy_argument.h"
+#include "framework/argument/enum/host_cache_state_argument.h"
+#include "framework/argument/enum/process_launcher_argument.h"
 #include "framework/argument/string_argument.h"
 #include "framework/argument/string_list_argument.h"
 #include "framework/utility/command_line_argument.h"
@@ -35,6 +39,7 @@ public:
   static bool parseArgumentsForConfiguration(CommandLineArguments &arguments);
   static void loadDefaultConfiguration();
   static Configuration &get();
+  static bool isLoaded();
 
   bool validateArgumentsExtra() const override;
 
@@ -59,6 +64,14 @@ public:
 
   // Api agnostic params
   StringArgument test;
+  StringArgument plan;
+  NonNegativeIntegerArgument shards;
+  StringArgument devices;
+  StringArgument shardTimes;
+  StringArgument shardOutput;
+  StringArgument resume;
+  PositiveIntegerArgument rounds;
+  NonNegativeIntegerArgument roundsSeed;
   DeviceSelectionArgument subDeviceSelection;
   BooleanFlagArgument csv;
   BooleanFlagArgument verbose;
@@ -78,6 +91,20 @@ public:
   BooleanFlagArgument markTimers;
   BooleanFlagArgument measurePower;
   BooleanFlagArgument printAllResults;
+  ProcessLauncherArgument processLauncher;
+  NonNegativeIntegerArgument processTimeout;
+  NonNegativeIntegerArgument processLaunchThreads;
+  CpuPlacementPolicyArgument cpuPlacement;
+  StringArgument cpuList;
+  HostAllocationPolicyArgument hostAllocationPolicy;
+  IntegerArgument hostNumaNode;
+  HostCacheStateArgument hostCacheState;
+  IntegerArgument seed;
+  NonNegativeIntegerArgument contentsEntropyBits;
+  PositiveIntegerArgument contentsRunLength;
+  BooleanFlagArgument reuseContexts;
+  NonNegativeIntegerArgument moduleCacheSize;
+  StringArgument moduleCacheDir;
 
   // Test specific params
   BooleanFlagArgument extended;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cpu.h"
+
+#include <fstream>
+#include <thread>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace CPU {
+
+std::string getModelName() {
+  std::ifstream cpuInfo{"/proc/cpuinfo"};
+  const std::string key = "model name";
+  for (std::string line; std::getline(cpuInfo, line);) {
+    if (line.compare(0, key.size(), key) != 0) {
+      continue;
+    }
+    const auto valuePosition = line.find(':');
+    if (valuePosition != std::string::npos) {
+      return line.substr(line.find_first_not_of(' ', valuePosition + 1));
+    }
+  }
+  return "Unknown";
+}
+
+size_t getLogicalCoresCount() { return std::thread::hardware_concurrency(); }
+
+SimdLevel getSimdLevel() {
+#if defined(__GNUC__) && defined(__x86_64__)
+  // Checks support of both the CPU and the OS for saving wider registers
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdLevel::Avx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return SimdLevel::Avx2;
+  }
+#elif defined(_MSC_VER) && defined(_M_X64)
+  int leaf1[4] = {};
+  int leaf7[4] = {};
+  __cpuid(leaf1, 1);
+  __cpuidex(leaf7, 7, 0);
+  const bool osSavesYmm = (leaf1[2] & (1 << 27)) != 0 &&
+                          (_xgetbv(0) & 0x6) == 0x6; // OSXSAVE, XMM and YMM
+  const bool osSavesZmm = osSavesYmm && (_xgetbv(0) & 0xe0) == 0xe0;
+  if (osSavesZmm && (leaf7[1] & (1 << 16)) != 0) { // AVX512F
+    return SimdLevel::Avx512;
+  }
+  if (osSavesYmm && (leaf7[1] & (1 << 5)) != 0 &&
+      (leaf1[2] & (1 << 12)) != 0) { // AVX2 and FMA
+    return SimdLevel::Avx2;
+  }
+#endif
+  return SimdLevel::Scalar;
+}
+
+std::string toString(SimdLevel simdLevel) {
+  switch (simdLevel) {
+  case SimdLevel::Avx512:
+    return "AVX-512";
+  case SimdLevel::Avx2:
+    return "AVX2";
+  default:
+    return "scalar";
+  }
+}
+
+} // namespace CPU
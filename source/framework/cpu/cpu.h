@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace CPU {
+
+// Widest vector instruction set usable on the host, ordered from the narrowest
+enum class SimdLevel {
+  Scalar,
+  Avx2,
+  Avx512,
+};
+
+std::string getModelName();
+size_t getLogicalCoresCount();
+SimdLevel getSimdLevel();
+std::string toString(SimdLevel simdLevel);
+
+} // namespace CPU
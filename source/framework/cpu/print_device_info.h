@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/cpu/cpu.h"
+
+#include <iostream>
+
+namespace CPU {
+
+inline void printDeviceInfo() {
+  std::cout << "CPU: " << getModelName() << std::endl;
+  std::cout << "\tlogicalCores: " << getLogicalCoresCount() << std::endl;
+  std::cout << "\tsimd: " << toString(getSimdLevel()) << std::endl;
+  std::cout << std::endl;
+}
+
+inline void printAvailableDevices() {
+  std::cout << "CPU: " << getModelName() << std::endl;
+  std::cout << "  host is always used, no device selection is available";
+  std::cout << std::endl << std::endl;
+}
+
+} // namespace CPU
@@ -21,11 +21,12 @@ enum class Api {
   SYCL,
   OMP,
   UR,
+  CPU,
 
   // Special values
   COUNT,
   FIRST = OpenCL,
-  LAST = UR,
+  LAST = CPU,
   All = 0xffff,
 };
 
@@ -42,6 +43,8 @@ inline std::string to_string(Api api) {
     return "omp";
   case Api::UR:
     return "ur";
+  case Api::CPU:
+    return "cpu";
   default:
     FATAL_ERROR("Unknown API");
   }
@@ -60,6 +63,8 @@ inline std::string getUserFriendlyApiName(Api api) {
     return "OpenMP";
   case Api::UR:
     return "UnifiedRuntime";
+  case Api::CPU:
+    return "CPU";
   default:
     FATAL_ERROR("Unknown API");
   }
@@ -78,6 +83,8 @@ inline Api parseApi(const std::string &value) {
     return Api::OMP;
   } else if (value == "ur") {
     return Api::UR;
+  } else if (value == "cpu") {
+    return Api::CPU;
   } else {
     return Api::Unknown;
   }
@@ -90,6 +97,7 @@ inline bool validateApi(Api api) {
   case Api::SYCL:
   case Api::OMP:
   case Api::UR:
+  case Api::CPU:
     return true;
   default:
     return false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,4 +12,6 @@ enum class BufferContents {
   Zeros,
   Random,
   IncreasingBytes,
+  Runs,
+  Entropy,
 };
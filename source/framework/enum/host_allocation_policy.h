@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Values following Default are ordered by the size of pages they provide
+enum class HostAllocationPolicy {
+  Unknown,
+
+  Default,
+  SmallPages,
+  TransparentHugePages,
+  HugeTlb2M,
+  HugeTlb1G,
+};
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+enum class HostCacheState {
+  Unknown,
+
+  Unchanged,
+  Cold,
+  LlcResident,
+  L1Resident,
+};
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+enum class HostCopyMethod {
+  Unknown,
+
+  Memcpy,
+  RepMovsb,
+  Avx2,
+  Avx2NonTemporal,
+  Avx512,
+  Avx512NonTemporal,
+};
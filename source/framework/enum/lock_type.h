@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+enum class LockType {
+  Unknown,
+
+  StdMutex,
+  SharedMutex,
+  Spinlock,
+  TicketLock,
+  McsLock,
+  FutexMutex,
+};
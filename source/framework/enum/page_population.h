@@ -0,0 +1,18 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+enum class PagePopulation {
+  Unknown,
+
+  Touch,
+  MapPopulate,
+  WillNeed,
+  PopulateWrite,
+  Userfaultfd,
+};
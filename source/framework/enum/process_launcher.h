@@ -0,0 +1,15 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+enum class ProcessLauncher {
+  Unknown,
+
+  Fork,
+  PosixSpawn,
+};
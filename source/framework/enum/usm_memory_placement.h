@@ -29,6 +29,22 @@ inline constexpr bool requiresImport(UsmMemoryPlacement inputType) {
   return false;
 }
 
+// Memory of these placements resides in host memory and is accessible by the
+// host directly
+inline constexpr bool isHostMemoryType(UsmMemoryPlacement inputType) {
+  switch (inputType) {
+  case UsmMemoryPlacement::Host:
+  case UsmMemoryPlacement::NonUsm:
+  case UsmMemoryPlacement::NonUsmImported:
+  case UsmMemoryPlacement::NonUsmMapped:
+  case UsmMemoryPlacement::NonUsm2MBAligned:
+  case UsmMemoryPlacement::NonUsmImported2MBAligned:
+    return true;
+  default:
+    return false;
+  }
+}
+
 inline constexpr bool isUsmMemoryType(UsmMemoryPlacement inputType) {
   switch (inputType) {
   case UsmMemoryPlacement::Host:
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "execution_plan.h"
+
+#include "framework/utility/string_utils.h"
+
+#include <cctype>
+#include <fstream>
+
+bool ExecutionPlan::load(const std::string &filePath, ExecutionPlan &outPlan,
+                         std::string &outErrorMessage) {
+  std::ifstream file{filePath};
+  if (!file.good()) {
+    outErrorMessage = "Cannot open plan file \"" + filePath + "\"";
+    return false;
+  }
+
+  outPlan.entries.clear();
+  std::string line{};
+  for (size_t lineNumber = 1; std::getline(file, line); lineNumber++) {
+    const size_t begin = line.find_first_not_of(" \t\r");
+    if (begin == std::string::npos || line[begin] == '#') {
+      continue;
+    }
+    line = line.substr(begin);
+
+    Entry entry{};
+    entry.lineNumber = lineNumber;
+    const bool parsed = line[0] == '{'
+                            ? parseJsonLine(line, entry, outErrorMessage)
+                            : parseTextLine(line, entry, outErrorMessage);
+    if (!parsed) {
+      outErrorMessage = "Line " + std::to_string(lineNumber) +
+                        " of plan file: " + outErrorMessage;
+      outPlan.entries.clear();
+      return false;
+    }
+    outPlan.entries.push_back(std::move(entry));
+  }
+
+  if (outPlan.entries.empty()) {
+    outErrorMessage = "Plan file \"" + filePath + "\" contains no tests";
+    return false;
+  }
+  return true;
+}
+
+bool ExecutionPlan::parseTextLine(const std::string &line, Entry &outEntry,
+                                  std::string &outErrorMessage) {
+  std::vector<std::string> tokens = splitString(line);
+
+  // Test name can be given bare or in the same way as on the command line
+  std::string key{};
+  std::string value{};
+  if (parseArgumentToKeyValue(tokens[0], key, value) && key == "test") {
+    outEntry.testName = value;
+  } else {
+    outEntry.testName = tokens[0];
+  }
+  if (outEntry.testName.empty()) {
+    outErrorMessage = "test name is empty";
+    return false;
+  }
+
+  outEntry.arguments.assign(tokens.begin() + 1, tokens.end());
+  return true;
+}
+
+bool ExecutionPlan::parseJsonLine(const std::string &line, Entry &outEntry,
+                                  std::string &outErrorMessage) {
+  size_t position = 0;
+  const auto skipSpaces = [&]() {
+    while (position < line.size() && std::isspace(line[position])) {
+      position++;
+    }
+  };
+  const auto consume = [&](char expected) {
+    skipSpaces();
+    if (position < line.size() && line[position] == expected) {
+      position++;
+      return true;
+    }
+    return false;
+  };
+  const auto parseString = [&](std::string &outString) {
+    if (!consume('"')) {
+      return false;
+    }
+    outString.clear();
+    while (position < line.size() && line[position] != '"') {
+      if (line[position] == '\\' && position + 1 < line.size()) {
+        position++;
+      }
+      outString += line[position++];
+    }
+    return consume('"');
+  };
+  const auto parseLiteral = [&](std::string &outLiteral) {
+    skipSpaces();
+    const size_t begin = position;
+    while (position < line.size() && line[position] != ',' &&
+           line[position] != '}' && !std::isspace(line[position])) {
+      position++;
+    }
+    outLiteral = line.substr(begin, position - begin);
+
+    // Boolean arguments of tests are parsed as integers
+    if (outLiteral == "true") {
+      outLiteral = "1";
+    } else if (outLiteral == "false") {
+      outLiteral = "0";
+    }
+    return !outLiteral.empty() && outLiteral != "null" &&
+           outLiteral[0] != '[' && outLiteral[0] != '{';
+  };
+
+  consume('{');
+  bool first = true;
+  while (!consume('}')) {
+    if (!first && !consume(',')) {
+      outErrorMessage = "expected ',' or '}' at column " +
+                        std::to_string(position + 1);
+      return false;
+    }
+    first = false;
+
+    std::string key{};
+    std::string value{};
+    bool parsed = parseString(key) && !key.empty() && consume(':');
+    if (parsed) {
+      skipSpaces();
+      const bool isString = position < line.size() && line[position] == '"';
+      parsed = isString ? parseString(value) : parseLiteral(value);
+    }
+    if (!parsed) {
+      outErrorMessage = "expected \"key\": value pair with a string, number "
+                        "or boolean value at column " +
+                        std::to_string(position + 1);
+      return false;
+    }
+
+    if (key == "test") {
+      outEntry.testName = value;
+    } else {
+      outEntry.arguments.push_back("--" + key + "=" + value);
+    }
+  }
+
+  skipSpaces();
+  if (position != line.size()) {
+    outErrorMessage = "unexpected characters after the JSON object";
+    return false;
+  }
+  if (outEntry.testName.empty()) {
+    outErrorMessage = "\"test\" key is missing";
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// List of test configurations executed in one process with --plan. Every line
+// of the plan file, which is not empty and is not a comment starting with '#',
+// describes one configuration. It can be written like in single-test mode or
+// as a flat JSON object, so the plan can be generated as NDJSON:
+//     TestName --someParam=1 --otherParam=30
+//     {"test": "TestName", "someParam": 1, "otherParam": "30"}
+// Global parameters, like --iterations or --api, cannot be used in the plan.
+// They are passed on the command line and apply to all entries.
+class ExecutionPlan {
+public:
+  struct Entry {
+    size_t lineNumber = 0;
+    std::string testName = {};
+    std::vector<std::string> arguments = {};
+  };
+
+  static bool load(const std::string &filePath, ExecutionPlan &outPlan,
+                   std::string &outErrorMessage);
+
+  const std::vector<Entry> &getEntries() const { return entries; }
+
+private:
+  static bool parseTextLine(const std::string &line, Entry &outEntry,
+                            std::string &outErrorMessage);
+  static bool parseJsonLine(const std::string &line, Entry &outEntry,
+                            std::string &outErrorMessage);
+
+  std::vector<Entry> entries = {};
+};
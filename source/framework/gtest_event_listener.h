@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,11 @@
 
 #include "framework/benchmark_info.h"
 #include "framework/configuration.h"
+#include "framework/sharded_execution.h"
 #include "framework/test_case/test_case_statistics.h"
 
+#include <chrono>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <sstream>
 
@@ -81,8 +84,54 @@ class SingleTestGtestListener : public ::testing::EmptyTestEventListener {
   }
 };
 
-template <typename ListenerType> void replaceGtestListener() {
+// Used in worker processes of --shards. Output of each test is captured and
+// written to the results file along with its runtime and errors, so the
+// parent can merge results of all workers. Every record is flushed right
+// away, so results of tests preceding a crash are not lost.
+class ShardWorkerGtestListener : public ::testing::EmptyTestEventListener {
+public:
+  ShardWorkerGtestListener(const std::string &outputFilePath)
+      : outputFile(outputFilePath, std::ios::out | std::ios::binary) {}
+
+private:
+  void
+  OnTestStart([[maybe_unused]] const ::testing::TestInfo &testCase) override {
+    currentOutput.str("");
+    currentErrors.str("");
+    originalBuffer = std::cout.rdbuf(currentOutput.rdbuf());
+    startTime = std::chrono::steady_clock::now();
+  }
+  void
+  OnTestPartResult(const ::testing::TestPartResult &testPartResult) override {
+    if (testPartResult.failed()) {
+      currentErrors << testPartResult.message() << "\n";
+    }
+  }
+  void OnTestEnd(const ::testing::TestInfo &testCase) override {
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - startTime;
+    std::cout.flush();
+    std::cout.rdbuf(originalBuffer);
+
+    ShardedExecution::TestRecord record{};
+    record.testName =
+        std::string(testCase.test_case_name()) + "." + testCase.name();
+    record.milliseconds = elapsed.count();
+    record.output = currentOutput.str();
+    record.errors = currentErrors.str();
+    outputFile << ShardedExecution::serializeRecord(record) << std::flush;
+  }
+
+  std::ofstream outputFile;
+  std::ostringstream currentOutput{};
+  std::ostringstream currentErrors{};
+  std::streambuf *originalBuffer = nullptr;
+  std::chrono::steady_clock::time_point startTime = {};
+};
+
+template <typename ListenerType, typename... Args>
+void replaceGtestListener(Args &&...args) {
   auto &listeners = ::testing::UnitTest::GetInstance()->listeners();
   delete listeners.Release(listeners.default_result_printer());
-  listeners.Append(new ListenerType());
+  listeners.Append(new ListenerType(std::forward<Args>(args)...));
 }
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "interleaved_execution.h"
+
+#include "framework/configuration.h"
+
+#include <numeric>
+
+InterleavedExecution &InterleavedExecution::get() {
+  const Configuration &configuration = Configuration::get();
+  static InterleavedExecution execution{
+      static_cast<size_t>(configuration.rounds),
+      static_cast<uint64_t>(configuration.roundsSeed)};
+  return execution;
+}
+
+InterleavedExecution::InterleavedExecution(size_t roundsCount, uint64_t seed)
+    : roundsCount(roundsCount), seed(seed) {}
+
+void InterleavedExecution::runAll(size_t iterations) {
+  std::vector<Config> configsToRun = std::move(configs);
+  configs.clear();
+
+  std::vector<bool> active(configsToRun.size(), true);
+  std::mt19937_64 generator{seed};
+  for (auto roundIndex = 0u; roundIndex < roundsCount; roundIndex++) {
+    const size_t roundIterations =
+        getIterationsInRound(iterations, roundsCount, roundIndex);
+    const std::vector<size_t> order =
+        getPermutation(configsToRun.size(), generator);
+    if (roundIterations == 0) {
+      continue;
+    }
+    for (size_t index : order) {
+      if (active[index]) {
+        active[index] = configsToRun[index].runRound(roundIterations);
+      }
+    }
+  }
+
+  for (const Config &config : configsToRun) {
+    config.printResults();
+  }
+}
+
+size_t InterleavedExecution::getIterationsInRound(size_t iterations,
+                                                  size_t roundsCount,
+                                                  size_t roundIndex) {
+  const size_t remainder = iterations % roundsCount;
+  return iterations / roundsCount + (roundIndex < remainder ? 1 : 0);
+}
+
+std::vector<size_t>
+InterleavedExecution::getPermutation(size_t count,
+                                     std::mt19937_64 &generator) {
+  std::vector<size_t> result(count);
+  std::iota(result.begin(), result.end(), size_t{0});
+  for (size_t i = count; i > 1; i--) {
+    std::swap(result[i - 1], result[generator() % i]);
+  }
+  return result;
+}
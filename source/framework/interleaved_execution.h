@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Executes test configs in rounds selected with --rounds. Tests do not run
+// right away, they only add their configs here. When all configs are known,
+// every round executes a part of iterations of each config, in an order
+// shuffled with --roundsSeed. Samples of all rounds are merged, so thermal
+// throttling and frequency drift affect all configs alike and configs
+// compared with each other are measured close in time.
+//
+// Results are printed after the last round, in the order in which configs
+// were added, so the output looks the same as in a regular run.
+class InterleavedExecution {
+public:
+  struct Config {
+    // Executes given number of iterations. Returns false, if the config
+    // should not be executed in the following rounds, e.g. after an error.
+    std::function<bool(size_t iterations)> runRound = {};
+    std::function<void()> printResults = {};
+  };
+
+  // Execution configured with --rounds. It is disabled with a single round.
+  static InterleavedExecution &get();
+  InterleavedExecution(size_t roundsCount, uint64_t seed);
+
+  bool isEnabled() const { return roundsCount > 1; }
+  size_t getRoundsCount() const { return roundsCount; }
+  void addConfig(Config &&config) { configs.push_back(std::move(config)); }
+
+  // Executes and removes all added configs
+  void runAll(size_t iterations);
+
+  // Iterations are split as evenly as possible, earlier rounds get the rest
+  static size_t getIterationsInRound(size_t iterations, size_t roundsCount,
+                                     size_t roundIndex);
+
+  // Same permutations for the same seed on every platform, unlike
+  // std::shuffle, which is implementation-defined
+  static std::vector<size_t> getPermutation(size_t count,
+                                            std::mt19937_64 &generator);
+
+private:
+  const size_t roundsCount;
+  const uint64_t seed;
+  std::vector<Config> configs = {};
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@ struct ContextProperties {
   DeviceSelection deviceSelection = DeviceSelection::Unknown;
   bool requireCreationSuccess = true;
   bool createContext = true;
+  bool coldContext = false;
   bool fakeSubDeviceAllowed = false;
 
   static ContextProperties create() {
@@ -37,6 +38,13 @@ struct ContextProperties {
     return *this;
   }
 
+  // Forces creating a new context and queue even if --reuseContexts is
+  // passed, for tests which must not observe state left by previous tests
+  ContextProperties &useColdContext() {
+    coldContext = true;
+    return *this;
+  }
+
   ContextProperties &allowCreationFail() {
     requireCreationSuccess = false;
     return *this;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,18 @@
 #include "levelzero.h"
 
 #include "framework/l0/utility/queue_families_helper.h"
+#include "framework/utility/context_cache.h"
 
 namespace L0 {
+using DefaultObjectsCache =
+    ContextCache<LevelZero::DefaultObjectsKey, LevelZero::DefaultObjects>;
+
+static DefaultObjectsCache &getDefaultObjectsCache() {
+  static DefaultObjectsCache cache{Configuration::get().reuseContexts,
+                                   LevelZero::destroyDefaultObjects};
+  return cache;
+}
+
 LevelZero::LevelZero(const QueueProperties &queueProperties,
                      const ContextProperties &contextProperties,
                      const ExtensionProperties &extensionProperties)
@@ -60,18 +70,26 @@ LevelZero::LevelZero(const QueueProperties &queueProperties,
     this->device = getDevice(contextProperties.deviceSelection);
   }
 
-  // Create context on the default device
-  this->context = createContext(contextProperties);
-  if (this->context == nullptr) {
+  // Create context and queue on the default device or reuse them
+  if (!contextProperties.createContext) {
     return;
   }
-
-  // Create queue
-  QueueFamiliesHelper::QueueDesc queueDesc = createQueue(queueProperties);
-  this->commandQueue = queueDesc.queue;
-  this->commandQueueDesc = queueDesc.desc;
-  this->commandQueueDevice = queueDesc.family.device;
-  this->commandQueueMaxFillSize = queueDesc.family.maxFillSize;
+  this->defaultObjectsKey = {driverIndex,
+                             rootDeviceIndex,
+                             contextProperties.deviceSelection,
+                             contextProperties.fakeSubDeviceAllowed,
+                             queueProperties.createQueue,
+                             queueProperties.selectedEngine,
+                             queueProperties.deviceSelection};
+  const DefaultObjects defaultObjects = getDefaultObjectsCache().acquire(
+      defaultObjectsKey, contextProperties.coldContext, [&]() {
+        return createDefaultObjects(queueProperties, contextProperties);
+      });
+  this->context = defaultObjects.context;
+  this->commandQueue = defaultObjects.commandQueue;
+  this->commandQueueDesc = defaultObjects.commandQueueDesc;
+  this->commandQueueDevice = defaultObjects.commandQueueDevice;
+  this->commandQueueMaxFillSize = defaultObjects.commandQueueMaxFillSize;
 
   initializeImportHostPointerExtension(extensionProperties);
 }
@@ -81,7 +99,39 @@ LevelZero::~LevelZero() noexcept(false) {
     EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(queue));
   }
   if (context != nullptr) {
-    EXPECT_ZE_RESULT_SUCCESS(zeContextDestroy(context));
+    getDefaultObjectsCache().release(
+        defaultObjectsKey, {context, commandQueue, commandQueueDesc,
+                            commandQueueDevice, commandQueueMaxFillSize});
+  }
+}
+
+LevelZero::DefaultObjects
+LevelZero::createDefaultObjects(const QueueProperties &queueProperties,
+                                const ContextProperties &contextProperties) {
+  DefaultObjects objects{};
+  objects.context = createContext(contextProperties);
+  if (objects.context == nullptr) {
+    return objects;
+  }
+
+  // Queue is owned by the DefaultObjects, so it is not tracked along with
+  // additional queues created by the test
+  this->context = objects.context;
+  QueueFamiliesHelper::QueueDesc queueDesc =
+      createQueue(queueProperties, false);
+  objects.commandQueue = queueDesc.queue;
+  objects.commandQueueDesc = queueDesc.desc;
+  objects.commandQueueDevice = queueDesc.family.device;
+  objects.commandQueueMaxFillSize = queueDesc.family.maxFillSize;
+  return objects;
+}
+
+void LevelZero::destroyDefaultObjects(DefaultObjects &objects) {
+  if (objects.commandQueue != nullptr) {
+    EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueDestroy(objects.commandQueue));
+  }
+  if (objects.context != nullptr) {
+    EXPECT_ZE_RESULT_SUCCESS(zeContextDestroy(objects.context));
   }
 }
 
@@ -134,6 +184,12 @@ LevelZero::createContext(const ContextProperties &contextProperties) {
 
 QueueFamiliesHelper::QueueDesc
 LevelZero::createQueue(const QueueProperties &queueProperties) {
+  return createQueue(queueProperties, true);
+}
+
+QueueFamiliesHelper::QueueDesc
+LevelZero::createQueue(const QueueProperties &queueProperties,
+                       bool trackQueue) {
   if (!queueProperties.createQueue) {
     return {};
   }
@@ -152,7 +208,12 @@ LevelZero::createQueue(const QueueProperties &queueProperties) {
   }
 
   // Create
-  queueDesc->queue = createQueue(deviceForQueue, queueDesc->desc);
+  if (trackQueue) {
+    queueDesc->queue = createQueue(deviceForQueue, queueDesc->desc);
+  } else {
+    EXPECT_ZE_RESULT_SUCCESS(zeCommandQueueCreate(
+        this->context, deviceForQueue, &queueDesc->desc, &queueDesc->queue));
+  }
   return *queueDesc;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "framework/utility/timer.h"
 
 #include <level_zero/ze_api.h>
+#include <tuple>
 
 namespace L0 {
 struct ImportHostPointerExtension {
@@ -177,11 +178,32 @@ struct LevelZero {
 
   std::vector<ze_device_handle_t> rootDevices{};
 
+  // Context and queue created by default. They are given to the ContextCache
+  // in the destructor, so with --reuseContexts following tests with the same
+  // setup can use them again.
+  struct DefaultObjects {
+    ze_context_handle_t context{};
+    ze_command_queue_handle_t commandQueue{};
+    ze_command_queue_desc_t commandQueueDesc{};
+    ze_device_handle_t commandQueueDevice{};
+    size_t commandQueueMaxFillSize{};
+  };
+  using DefaultObjectsKey = std::tuple<size_t, size_t, DeviceSelection, bool,
+                                       bool, Engine, DeviceSelection>;
+  static void destroyDefaultObjects(DefaultObjects &objects);
+
 private:
+  DefaultObjects
+  createDefaultObjects(const QueueProperties &queueProperties,
+                       const ContextProperties &contextProperties);
+  QueueFamiliesHelper::QueueDesc
+  createQueue(const QueueProperties &queueProperties, bool trackQueue);
+
   // Internal fields managed by the LevelZero class
   ze_device_handle_t rootDevice{};
   std::vector<ze_device_handle_t> subDevices{};
   std::vector<ze_command_queue_handle_t> commandQueues{};
+  DefaultObjectsKey defaultObjectsKey{};
 };
 } // namespace L0
 
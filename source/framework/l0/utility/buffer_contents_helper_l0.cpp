@@ -34,8 +34,10 @@ ze_result_t BufferContentsHelperL0::fillBuffer(
     retVal = fillBufferWithZeros(cmdList, buffer, bufferSize);
     break;
   case BufferContents::Random:
-    retVal = fillBufferWithRandomBytes(context, cmdList, buffer, bufferSize,
-                                       stagingAllocation);
+  case BufferContents::Runs:
+  case BufferContents::Entropy:
+    retVal = fillBufferFromHost(context, cmdList, buffer, bufferSize, contents,
+                                stagingAllocation);
     break;
   default:
     FATAL_ERROR("Unknown buffer contents");
@@ -51,7 +53,7 @@ ze_result_t BufferContentsHelperL0::fillBuffer(
 
   ZE_RESULT_SUCCESS_OR_RETURN(zeCommandListDestroy(cmdList));
 
-  if (contents == BufferContents::Random) {
+  if (stagingAllocation != nullptr) {
     ZE_RESULT_SUCCESS_OR_RETURN(zeMemFree(context, stagingAllocation));
   }
 
@@ -67,14 +69,14 @@ ze_result_t BufferContentsHelperL0::fillBuffer(LevelZero &levelzero,
                     contents, useImmediate);
 }
 
-ze_result_t BufferContentsHelperL0::fillBufferWithRandomBytes(
+ze_result_t BufferContentsHelperL0::fillBufferFromHost(
     ze_context_handle_t context, ze_command_list_handle_t cmdList, void *buffer,
-    size_t bufferSize, void *&stagingAllocation) {
+    size_t bufferSize, BufferContents contents, void *&stagingAllocation) {
   // Create staging allocation
   ze_host_mem_alloc_desc_t desc{ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
   ZE_RESULT_SUCCESS_OR_RETURN(
       zeMemAllocHost(context, &desc, bufferSize, 0, &stagingAllocation));
-  fillWithRandomBytes(static_cast<uint8_t *>(stagingAllocation), bufferSize);
+  fill(static_cast<uint8_t *>(stagingAllocation), bufferSize, contents);
 
   // Copy to destination allocation
   ZE_RESULT_SUCCESS_OR_RETURN(zeCommandListAppendMemoryCopy(
@@ -24,10 +24,11 @@ public:
                                 bool useImmediate);
 
 private:
-  static ze_result_t fillBufferWithRandomBytes(ze_context_handle_t context,
-                                               ze_command_list_handle_t cmdList,
-                                               void *buffer, size_t bufferSize,
-                                               void *&stagingAllocation);
+  static ze_result_t fillBufferFromHost(ze_context_handle_t context,
+                                        ze_command_list_handle_t cmdList,
+                                        void *buffer, size_t bufferSize,
+                                        BufferContents contents,
+                                        void *&stagingAllocation);
 
   static ze_result_t fillBufferWithZeros(ze_command_list_handle_t cmdList,
                                          void *buffer, size_t bufferSize);
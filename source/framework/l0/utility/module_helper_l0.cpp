@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "module_helper_l0.h"
+
+#include "framework/utility/file_helper.h"
+#include "framework/utility/module_cache.h"
+
+#include <iomanip>
+#include <sstream>
+
+TestResult ModuleHelperL0::createModuleFromSpirvFile(
+    LevelZero &levelzero, const std::string &fileName, const char *buildFlags,
+    ze_module_handle_t &outModule) {
+  return createModuleFromSpirvFile(levelzero, levelzero.device, fileName,
+                                   buildFlags, outModule);
+}
+
+TestResult ModuleHelperL0::createModuleFromSpirvFile(
+    LevelZero &levelzero, ze_device_handle_t device,
+    const std::string &fileName, const char *buildFlags,
+    ze_module_handle_t &outModule) {
+  const FileHelper::MappedFile spirv{fileName};
+  if (!spirv.isValid()) {
+    return TestResult::KernelNotFound;
+  }
+  return createModuleFromSpirv(levelzero, device, spirv.getData(),
+                               spirv.getSize(), buildFlags, outModule);
+}
+
+TestResult ModuleHelperL0::createModuleFromSpirv(
+    LevelZero &levelzero, ze_device_handle_t device, const uint8_t *spirv,
+    size_t spirvSize, const char *buildFlags, ze_module_handle_t &outModule) {
+  ModuleCache &cache = ModuleCache::get();
+  ModuleCache::Key key{};
+  std::vector<uint8_t> nativeBinary{};
+  ze_module_desc_t moduleDesc{ZE_STRUCTURE_TYPE_MODULE_DESC};
+  moduleDesc.pBuildFlags = buildFlags;
+
+  // Create from the cached native binary. If the driver rejects it, the module
+  // is built from SPIR-V and the binary is replaced.
+  if (cache.isEnabled()) {
+    key = ModuleCache::createKey(spirv, spirvSize,
+                                 buildFlags ? buildFlags : "",
+                                 getDeviceDescription(levelzero, device));
+    if (cache.load(key, nativeBinary)) {
+      moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+      moduleDesc.pInputModule = nativeBinary.data();
+      moduleDesc.inputSize = nativeBinary.size();
+      if (zeModuleCreate(levelzero.context, device, &moduleDesc, &outModule,
+                         nullptr) == ZE_RESULT_SUCCESS) {
+        return TestResult::Success;
+      }
+    }
+  }
+
+  moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+  moduleDesc.pInputModule = spirv;
+  moduleDesc.inputSize = spirvSize;
+  ASSERT_ZE_RESULT_SUCCESS(zeModuleCreate(levelzero.context, device,
+                                          &moduleDesc, &outModule, nullptr));
+
+  if (cache.isEnabled()) {
+    size_t nativeBinarySize = 0;
+    ASSERT_ZE_RESULT_SUCCESS(
+        zeModuleGetNativeBinary(outModule, &nativeBinarySize, nullptr));
+    nativeBinary.resize(nativeBinarySize);
+    ASSERT_ZE_RESULT_SUCCESS(zeModuleGetNativeBinary(
+        outModule, &nativeBinarySize, nativeBinary.data()));
+    cache.store(key, nativeBinary);
+  }
+  return TestResult::Success;
+}
+
+std::string ModuleHelperL0::getDeviceDescription(LevelZero &levelzero,
+                                                 ze_device_handle_t device) {
+  // Native binaries depend on the device and the compiler of the driver
+  ze_driver_properties_t driverProperties{ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES};
+  EXPECT_ZE_RESULT_SUCCESS(
+      zeDriverGetProperties(levelzero.driver, &driverProperties));
+  const ze_device_properties_t deviceProperties =
+      levelzero.getDeviceProperties(device);
+
+  std::ostringstream result{};
+  result << "L0 " << std::hex << deviceProperties.vendorId << ":"
+         << deviceProperties.deviceId << " " << deviceProperties.name
+         << " driver " << driverProperties.driverVersion << " uuid ";
+  for (uint8_t byte : deviceProperties.uuid.id) {
+    result << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(byte);
+  }
+  return result.str();
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/l0/levelzero.h"
+#include "framework/test_case/test_result.h"
+
+#include <string>
+
+// Creates modules from SPIR-V files. When the ModuleCache is enabled with
+// --moduleCacheSize or --moduleCacheDir, native binaries of built modules are
+// cached and following modules are created from them, without compiling the
+// SPIR-V again.
+class ModuleHelperL0 {
+public:
+  static TestResult createModuleFromSpirvFile(LevelZero &levelzero,
+                                              const std::string &fileName,
+                                              const char *buildFlags,
+                                              ze_module_handle_t &outModule);
+  static TestResult createModuleFromSpirvFile(LevelZero &levelzero,
+                                              ze_device_handle_t device,
+                                              const std::string &fileName,
+                                              const char *buildFlags,
+                                              ze_module_handle_t &outModule);
+  static TestResult createModuleFromSpirv(LevelZero &levelzero,
+                                          ze_device_handle_t device,
+                                          const uint8_t *spirv,
+                                          size_t spirvSize,
+                                          const char *buildFlags,
+                                          ze_module_handle_t &outModule);
+
+private:
+  static std::string getDeviceDescription(LevelZero &levelzero,
+                                          ze_device_handle_t device);
+};
@@ -8,6 +8,7 @@
 #include "framework/l0/utility/usm_helper.h"
 
 #include "framework/utility/aligned_allocator.h"
+#include "framework/utility/host_allocator.h"
 
 namespace L0::UsmHelper {
 
@@ -31,7 +32,7 @@ ze_result_t allocate(UsmMemoryPlacement placement, LevelZero &levelZero,
     if (placement == UsmMemoryPlacement::NonUsmImported2MBAligned) {
       *buffer = alloc2MBAligned(size);
     } else {
-      *buffer = malloc(size);
+      *buffer = HostAllocator::allocate(size);
     }
     return levelZero.importHostPointer.importExternalPointer(levelZero.driver,
                                                              *buffer, size);
@@ -41,7 +42,7 @@ ze_result_t allocate(UsmMemoryPlacement placement, LevelZero &levelZero,
     if (placement == UsmMemoryPlacement::NonUsm2MBAligned) {
       *buffer = alloc2MBAligned(size);
     } else {
-      *buffer = malloc(size);
+      *buffer = HostAllocator::allocate(size);
     }
     return ZE_RESULT_SUCCESS;
   }
@@ -94,12 +95,12 @@ ze_result_t deallocate(UsmMemoryPlacement placement, LevelZero &levelZero,
                        void *buffer) {
   if (placement == UsmMemoryPlacement::NonUsm ||
       placement == UsmMemoryPlacement::NonUsm2MBAligned) {
-    free(buffer);
+    HostAllocator::free(buffer);
     return ZE_RESULT_SUCCESS;
   } else if (requiresImport(placement)) {
     auto ret = levelZero.importHostPointer.releaseExternalPointer(
         levelZero.driver, buffer);
-    free(buffer);
+    HostAllocator::free(buffer);
     return ret;
   } else {
     return zeMemFree(levelZero.context, buffer);
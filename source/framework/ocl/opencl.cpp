@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,19 @@
 
 #include "opencl.h"
 
+#include "framework/utility/context_cache.h"
+
+#include <algorithm>
+
 namespace OCL {
+using DefaultObjectsCache =
+    ContextCache<Opencl::DefaultObjectsKey, Opencl::DefaultObjects>;
+
+static DefaultObjectsCache &getDefaultObjectsCache() {
+  static DefaultObjectsCache cache{Configuration::get().reuseContexts,
+                                   Opencl::destroyDefaultObjects};
+  return cache;
+}
 
 Opencl::Opencl(const QueueProperties &queueProperties,
                const ContextProperties &contextProperties) {
@@ -70,17 +82,49 @@ Opencl::Opencl(const QueueProperties &queueProperties,
     this->device = getDevice(contextProperties.deviceSelection);
   }
 
-  // Create context on the default device
-  this->context = createContext(contextProperties);
-  if (this->context == nullptr) {
+  // Create context and command queue on the default device or reuse them
+  const auto createDefaultObjects = [&]() {
+    DefaultObjects objects{};
+    objects.context = this->context = createContext(contextProperties);
+    if (objects.context != nullptr) {
+      objects.commandQueue = createQueue(queueProperties);
+    }
+    return objects;
+  };
+  this->defaultObjectsReusable =
+      contextProperties.createContext &&
+      !DeviceSelectionHelper::hasAnySubDevice(
+          contextProperties.deviceSelection) &&
+      !DeviceSelectionHelper::hasAnySubDevice(queueProperties.deviceSelection);
+  if (!defaultObjectsReusable) {
+    const DefaultObjects defaultObjects = createDefaultObjects();
+    this->commandQueue = defaultObjects.commandQueue;
     return;
   }
-
-  // Create command queue on the default device
-  this->commandQueue = createQueue(queueProperties);
+  this->defaultObjectsKey = {platform,
+                             rootDevice,
+                             queueProperties.createQueue,
+                             queueProperties.profiling,
+                             queueProperties.selectedEngine,
+                             queueProperties.ooq,
+                             queueProperties.deviceSelection};
+  const DefaultObjects defaultObjects = getDefaultObjectsCache().acquire(
+      defaultObjectsKey, contextProperties.coldContext, createDefaultObjects);
+  this->context = defaultObjects.context;
+  this->commandQueue = defaultObjects.commandQueue;
 }
 
 Opencl::~Opencl() noexcept(false) {
+  // Default objects are not released with the rest, if they can be reused
+  if (defaultObjectsReusable && context != nullptr) {
+    commandQueues.erase(
+        std::remove(commandQueues.begin(), commandQueues.end(), commandQueue),
+        commandQueues.end());
+    contexts.erase(std::remove(contexts.begin(), contexts.end(), context),
+                   contexts.end());
+    getDefaultObjectsCache().release(defaultObjectsKey,
+                                     {context, commandQueue});
+  }
   for (auto &queueToRelease : commandQueues) {
     EXPECT_CL_SUCCESS(clReleaseCommandQueue(queueToRelease));
   }
@@ -92,6 +136,15 @@ Opencl::~Opencl() noexcept(false) {
   }
 }
 
+void Opencl::destroyDefaultObjects(DefaultObjects &objects) {
+  if (objects.commandQueue != nullptr) {
+    EXPECT_CL_SUCCESS(clReleaseCommandQueue(objects.commandQueue));
+  }
+  if (objects.context != nullptr) {
+    EXPECT_CL_SUCCESS(clReleaseContext(objects.context));
+  }
+}
+
 cl_command_queue Opencl::createQueue(QueueProperties queueProperties) {
   if (!queueProperties.createQueue) {
     return nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@
 #include "framework/ocl/utility/extensions_helper.h"
 #include "framework/test_case/test_case.h"
 
+#include <tuple>
+
 namespace OCL {
 
 // Class handles regular OpenCL boilerplate code, such as querying driver
@@ -53,6 +55,18 @@ struct Opencl {
   // implementation
   const ExtensionsHelper &getExtensions();
 
+  // Context and queue created by default. They are given to the ContextCache
+  // in the destructor, so with --reuseContexts following tests with the same
+  // setup can use them again. Objects created on subDevices are not reused,
+  // because subDevices are created anew for each Opencl object.
+  struct DefaultObjects {
+    cl_context context{};
+    cl_command_queue commandQueue{};
+  };
+  using DefaultObjectsKey = std::tuple<cl_platform_id, cl_device_id, bool,
+                                       bool, Engine, int, DeviceSelection>;
+  static void destroyDefaultObjects(DefaultObjects &objects);
+
 private:
   // Queriers subDevices of the root device and creates them if any. This method
   // is only called when it's necessary, i.e. user specified some subDevices in
@@ -65,6 +79,8 @@ private:
   std::vector<cl_context> contexts{};
   std::vector<cl_command_queue> commandQueues{};
   std::unique_ptr<ExtensionsHelper> extensionsHelper{};
+  bool defaultObjectsReusable = false;
+  DefaultObjectsKey defaultObjectsKey{};
 };
 
 } // namespace OCL
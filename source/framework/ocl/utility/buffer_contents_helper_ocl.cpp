@@ -9,6 +9,7 @@
 
 #include "framework/ocl/function_signatures_ocl.h"
 #include "framework/ocl/utility/error.h"
+#include "framework/utility/host_allocator.h"
 
 #include <memory>
 
@@ -19,9 +20,10 @@ cl_int BufferContentsHelperOcl::fillBuffer(cl_command_queue queue,
   case BufferContents::Zeros:
     return fillBufferWithZeros(queue, buffer, bufferSize);
   case BufferContents::Random:
-    return fillBufferWithRandomBytes(queue, buffer, bufferSize);
   case BufferContents::IncreasingBytes:
-    return fillBufferWithIncreasingBytes(queue, buffer, bufferSize);
+  case BufferContents::Runs:
+  case BufferContents::Entropy:
+    return fillBufferFromHost(queue, buffer, bufferSize, contents);
   default:
     FATAL_ERROR("Unknown buffer contents");
   }
@@ -45,10 +47,12 @@ cl_int BufferContentsHelperOcl::fillUsmBufferOrHostPtr(
   }
 }
 
-cl_int BufferContentsHelperOcl::fillBufferWithRandomBytes(
-    cl_command_queue queue, cl_mem buffer, size_t bufferSize) {
-  auto cpuBuffer = std::make_unique<uint8_t[]>(bufferSize);
-  BufferContentsHelper::fillWithRandomBytes(cpuBuffer.get(), bufferSize);
+cl_int BufferContentsHelperOcl::fillBufferFromHost(cl_command_queue queue,
+                                                   cl_mem buffer,
+                                                   size_t bufferSize,
+                                                   BufferContents contents) {
+  auto cpuBuffer = HostAllocator::allocateArray<uint8_t>(bufferSize);
+  BufferContentsHelper::fill(cpuBuffer.get(), bufferSize, contents);
   CL_SUCCESS_OR_RETURN(clEnqueueWriteBuffer(queue, buffer, CL_BLOCKING, 0,
                                             bufferSize, cpuBuffer.get(), 0,
                                             nullptr, nullptr));
@@ -66,16 +70,6 @@ cl_int BufferContentsHelperOcl::fillBufferWithZeros(cl_command_queue queue,
   return CL_SUCCESS;
 }
 
-cl_int BufferContentsHelperOcl::fillBufferWithIncreasingBytes(
-    cl_command_queue queue, cl_mem buffer, size_t bufferSize) {
-  auto cpuBuffer = std::make_unique<uint8_t[]>(bufferSize);
-  BufferContentsHelper::fillWithIncreasingBytes(cpuBuffer.get(), bufferSize);
-  CL_SUCCESS_OR_RETURN(clEnqueueWriteBuffer(queue, buffer, CL_BLOCKING, 0,
-                                            bufferSize, cpuBuffer.get(), 0,
-                                            nullptr, nullptr));
-  return CL_SUCCESS;
-}
-
 cl_int BufferContentsHelperOcl::fillUsmBuffer(cl_command_queue queue,
                                               void *usmBuffer,
                                               size_t bufferSize,
@@ -84,14 +78,18 @@ cl_int BufferContentsHelperOcl::fillUsmBuffer(cl_command_queue queue,
   case BufferContents::Zeros:
     return fillUsmBufferWithZeros(queue, usmBuffer, bufferSize);
   case BufferContents::Random:
-    return fillUsmBufferWithRandomBytes(queue, usmBuffer, bufferSize);
+  case BufferContents::Runs:
+  case BufferContents::Entropy:
+    return fillUsmBufferFromHost(queue, usmBuffer, bufferSize, contents);
   default:
     FATAL_ERROR("Unknown buffer contents");
   }
 }
 
-cl_int BufferContentsHelperOcl::fillUsmBufferWithRandomBytes(
-    cl_command_queue queue, void *usmBuffer, size_t bufferSize) {
+cl_int BufferContentsHelperOcl::fillUsmBufferFromHost(cl_command_queue queue,
+                                                      void *usmBuffer,
+                                                      size_t bufferSize,
+                                                      BufferContents contents) {
   // Get API calls
   cl_device_id device = {};
   CL_SUCCESS_OR_RETURN(clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE,
@@ -117,7 +115,7 @@ cl_int BufferContentsHelperOcl::fillUsmBufferWithRandomBytes(
   void *stagingAlloc =
       clHostMemAllocINTEL(context, nullptr, bufferSize, 0, &retVal);
   CL_SUCCESS_OR_RETURN(retVal);
-  fillWithRandomBytes(static_cast<uint8_t *>(stagingAlloc), bufferSize);
+  fill(static_cast<uint8_t *>(stagingAlloc), bufferSize, contents);
 
   // Copy to destination allocation
   CL_SUCCESS_OR_RETURN(clEnqueueMemcpyINTEL(queue, CL_NON_BLOCKING, usmBuffer,
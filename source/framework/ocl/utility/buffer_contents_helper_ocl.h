@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,18 +21,16 @@ public:
                                        BufferContents contents);
 
 private:
-  static cl_int fillBufferWithRandomBytes(cl_command_queue queue, cl_mem buffer,
-                                          size_t bufferSize);
+  static cl_int fillBufferFromHost(cl_command_queue queue, cl_mem buffer,
+                                   size_t bufferSize, BufferContents contents);
   static cl_int fillBufferWithZeros(cl_command_queue queue, cl_mem buffer,
                                     size_t bufferSize);
-  static cl_int fillBufferWithIncreasingBytes(cl_command_queue queue,
-                                              cl_mem buffer, size_t bufferSize);
 
   static cl_int fillUsmBuffer(cl_command_queue queue, void *usmBuffer,
                               size_t bufferSize, BufferContents contents);
-  static cl_int fillUsmBufferWithRandomBytes(cl_command_queue queue,
-                                             void *usmBuffer,
-                                             size_t bufferSize);
+  static cl_int fillUsmBufferFromHost(cl_command_queue queue, void *usmBuffer,
+                                      size_t bufferSize,
+                                      BufferContents contents);
   static cl_int fillUsmBufferWithZeros(cl_command_queue queue, void *usmBuffer,
                                        size_t bufferSize);
 };
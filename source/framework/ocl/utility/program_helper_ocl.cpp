@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,13 +9,102 @@
 
 #include "framework/ocl/utility/error.h"
 #include "framework/utility/file_helper.h"
+#include "framework/utility/module_cache.h"
 #include "framework/utility/string_utils.h"
 
+#include <sstream>
+
+static std::string getDeviceDescription(cl_device_id device) {
+  // Native binaries depend on the device and the compiler of the driver
+  std::ostringstream result{};
+  result << "OCL";
+  for (cl_device_info info :
+       {CL_DEVICE_NAME, CL_DEVICE_VERSION, CL_DRIVER_VERSION}) {
+    size_t size = 0;
+    EXPECT_CL_SUCCESS(clGetDeviceInfo(device, info, 0, nullptr, &size));
+    std::string value(size, '\0');
+    EXPECT_CL_SUCCESS(
+        clGetDeviceInfo(device, info, size, value.data(), nullptr));
+    result << " " << value.c_str();
+  }
+  cl_uint vendorId = 0;
+  EXPECT_CL_SUCCESS(clGetDeviceInfo(device, CL_DEVICE_VENDOR_ID,
+                                    sizeof(vendorId), &vendorId, nullptr));
+  result << " vendor " << std::hex << vendorId;
+  return result.str();
+}
+
+static cl_program buildProgramFromBinary(cl_context context,
+                                         cl_device_id device,
+                                         const std::vector<uint8_t> &binary,
+                                         const char *compileOptions) {
+  const unsigned char *binaryData = binary.data();
+  const size_t binarySize = binary.size();
+  cl_int binaryStatus{};
+  cl_int retVal{};
+  cl_program program =
+      clCreateProgramWithBinary(context, 1, &device, &binarySize, &binaryData,
+                                &binaryStatus, &retVal);
+  if (retVal != CL_SUCCESS || binaryStatus != CL_SUCCESS) {
+    if (program != nullptr) {
+      clReleaseProgram(program);
+    }
+    return nullptr;
+  }
+  if (clBuildProgram(program, 1, &device, compileOptions, nullptr, nullptr) !=
+      CL_SUCCESS) {
+    clReleaseProgram(program);
+    return nullptr;
+  }
+  return program;
+}
+
+static TestResult getProgramBinary(cl_program program,
+                                   std::vector<uint8_t> &outBinary) {
+  // Only programs built for a single device are cached
+  cl_uint devicesCount = 0;
+  ASSERT_CL_SUCCESS(clGetProgramInfo(program, CL_PROGRAM_NUM_DEVICES,
+                                     sizeof(devicesCount), &devicesCount,
+                                     nullptr));
+  if (devicesCount != 1) {
+    return TestResult::Success;
+  }
+
+  size_t binarySize = 0;
+  ASSERT_CL_SUCCESS(clGetProgramInfo(program, CL_PROGRAM_BINARY_SIZES,
+                                     sizeof(binarySize), &binarySize,
+                                     nullptr));
+  outBinary.resize(binarySize);
+  unsigned char *binaryData = outBinary.data();
+  ASSERT_CL_SUCCESS(clGetProgramInfo(program, CL_PROGRAM_BINARIES,
+                                     sizeof(binaryData), &binaryData,
+                                     nullptr));
+  return TestResult::Success;
+}
+
 TestResult OCL::ProgramHelperOcl::buildProgramFromSource(
     cl_context context, cl_device_id device, const char *source,
     size_t sourceLength, const char *compileOptions, cl_program &outProgram) {
   FATAL_ERROR_IF(outProgram != nullptr, "Non-null program passed");
 
+  // Create from the cached native binary. If the driver rejects it, the
+  // program is built from source and the binary is replaced.
+  ModuleCache &cache = ModuleCache::get();
+  ModuleCache::Key key{};
+  if (cache.isEnabled()) {
+    key = ModuleCache::createKey(source, sourceLength,
+                                 compileOptions ? compileOptions : "",
+                                 getDeviceDescription(device));
+    std::vector<uint8_t> binary{};
+    if (cache.load(key, binary)) {
+      outProgram =
+          buildProgramFromBinary(context, device, binary, compileOptions);
+      if (outProgram != nullptr) {
+        return TestResult::Success;
+      }
+    }
+  }
+
   cl_int retVal{};
   cl_program program =
       clCreateProgramWithSource(context, 1, &source, &sourceLength, &retVal);
@@ -35,6 +124,15 @@ TestResult OCL::ProgramHelperOcl::buildProgramFromSource(
     return TestResult::KernelBuildError;
   }
 
+  if (cache.isEnabled()) {
+    std::vector<uint8_t> binary{};
+    if (auto result = getProgramBinary(program, binary);
+        result != TestResult::Success) {
+      return result;
+    }
+    cache.store(key, binary);
+  }
+
   outProgram = program;
   return TestResult::Success;
 }
@@ -42,13 +140,12 @@ TestResult OCL::ProgramHelperOcl::buildProgramFromSource(
 TestResult OCL::ProgramHelperOcl::buildProgramFromSourceFile(
     cl_context context, cl_device_id device, const char *sourceFileName,
     const char *compileOptions, cl_program &outProgram) {
-  const std::vector<uint8_t> kernelSource =
-      FileHelper::loadTextFile(sourceFileName);
-  if (kernelSource.size() == 0) {
+  const FileHelper::MappedFile kernelSource{sourceFileName};
+  if (!kernelSource.isValid()) {
     return TestResult::KernelNotFound;
   }
-  const char *source = reinterpret_cast<const char *>(kernelSource.data());
-  const size_t sourceLength = kernelSource.size();
+  const char *source = reinterpret_cast<const char *>(kernelSource.getData());
+  const size_t sourceLength = kernelSource.getSize();
   return buildProgramFromSource(context, device, source, sourceLength,
                                 compileOptions, outProgram);
 }
@@ -8,6 +8,7 @@
 #include "usm_helper_ocl.h"
 
 #include "framework/utility/aligned_allocator.h"
+#include "framework/utility/host_allocator.h"
 
 cl_int UsmHelperOcl::allocate(Opencl &opencl, UsmMemoryPlacement placement,
                               size_t bufferSize, Alloc &outAlloc) {
@@ -34,7 +35,7 @@ cl_int UsmHelperOcl::allocate(Opencl &opencl, UsmMemoryPlacement placement,
         opencl.context, opencl.device, nullptr, bufferSize, 0, &retVal);
     break;
   case UsmMemoryPlacement::NonUsm:
-    outAlloc.ptr = new uint8_t[bufferSize];
+    outAlloc.ptr = HostAllocator::allocate(bufferSize);
     break;
   case UsmMemoryPlacement::NonUsm2MBAligned:
     outAlloc.ptr = alloc2MBAligned(bufferSize);
@@ -68,10 +69,8 @@ cl_int UsmHelperOcl::deallocate(Alloc &alloc) {
     retVal = alloc.usm.clMemFreeINTEL(alloc.context, alloc.ptr);
     break;
   case UsmMemoryPlacement::NonUsm:
-    delete[] (static_cast<uint8_t *>(alloc.ptr));
-    break;
   case UsmMemoryPlacement::NonUsm2MBAligned:
-    free(alloc.ptr);
+    HostAllocator::free(alloc.ptr);
     break;
   case UsmMemoryPlacement::NonUsmMapped:
     CL_SUCCESS_OR_RETURN(clEnqueueUnmapMemObject(
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "sharded_execution.h"
+
+#include "framework/utility/string_utils.h"
+#include "framework/utility/working_directory_helper.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+bool ShardedExecution::loadRuntimes(const std::string &filePath,
+                                    Runtimes &outRuntimes,
+                                    std::string &outErrorMessage) {
+  outRuntimes.clear();
+  std::ifstream file{filePath};
+  if (!file.good()) {
+    return true;
+  }
+
+  std::string line{};
+  for (size_t lineNumber = 1; std::getline(file, line); lineNumber++) {
+    const std::vector<std::string> tokens = splitString(line);
+    if (tokens.empty() || tokens[0][0] == '#') {
+      continue;
+    }
+
+    char *end = nullptr;
+    const double milliseconds =
+        tokens.size() == 2 ? std::strtod(tokens[1].c_str(), &end) : -1;
+    if (milliseconds < 0 || end == nullptr || *end != '\0') {
+      outErrorMessage = "Line " + std::to_string(lineNumber) +
+                        " of runtimes file \"" + filePath +
+                        "\" is not in format: <testName> <milliseconds>";
+      outRuntimes.clear();
+      return false;
+    }
+    outRuntimes[tokens[0]] = milliseconds;
+  }
+  return true;
+}
+
+bool ShardedExecution::saveRuntimes(const std::string &filePath,
+                                    const Runtimes &runtimes) {
+  // File is replaced at once, so an interrupted run does not lose the history
+  const std::string temporaryFilePath = filePath + ".tmp";
+  {
+    std::ofstream file{temporaryFilePath};
+    if (!file.good()) {
+      return false;
+    }
+    file << "# Runtimes of tests in milliseconds, used to balance --shards\n";
+    file << std::fixed << std::setprecision(3);
+    for (const auto &[testName, milliseconds] : runtimes) {
+      file << testName << ' ' << milliseconds << '\n';
+    }
+    if (!file.good()) {
+      return false;
+    }
+  }
+
+  std::error_code error{};
+  FileSystem::rename(temporaryFilePath, filePath, error);
+  return !error;
+}
+
+std::vector<ShardedExecution::Shard>
+ShardedExecution::partition(const std::vector<std::string> &testNames,
+                            const Runtimes &runtimes, size_t shardsCount,
+                            const std::vector<std::string> &devices) {
+  std::vector<Shard> shards(shardsCount);
+  for (auto shardIndex = 0u; shardIndex < shardsCount; shardIndex++) {
+    if (!devices.empty()) {
+      shards[shardIndex].device = devices[shardIndex % devices.size()];
+    }
+  }
+  if (shardsCount == 0) {
+    return shards;
+  }
+
+  // Estimate runtimes of all tests
+  double knownSum = 0;
+  size_t knownCount = 0;
+  for (const std::string &testName : testNames) {
+    if (const auto it = runtimes.find(testName); it != runtimes.end()) {
+      knownSum += it->second;
+      knownCount++;
+    }
+  }
+  const double defaultRuntime = knownCount > 0 ? knownSum / knownCount : 1;
+  std::vector<double> estimates{};
+  for (const std::string &testName : testNames) {
+    const auto it = runtimes.find(testName);
+    estimates.push_back(it != runtimes.end() ? it->second : defaultRuntime);
+  }
+
+  // Longest processing time first
+  std::vector<size_t> order(testNames.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return estimates[a] > estimates[b];
+  });
+  std::vector<std::vector<size_t>> assignedTests(shardsCount);
+  for (size_t testIndex : order) {
+    const auto leastLoaded =
+        std::min_element(shards.begin(), shards.end(),
+                         [](const Shard &a, const Shard &b) {
+                           return a.expectedMilliseconds <
+                                  b.expectedMilliseconds;
+                         });
+    leastLoaded->expectedMilliseconds += estimates[testIndex];
+    assignedTests[leastLoaded - shards.begin()].push_back(testIndex);
+  }
+
+  for (auto shardIndex = 0u; shardIndex < shardsCount; shardIndex++) {
+    std::vector<size_t> &tests = assignedTests[shardIndex];
+    std::sort(tests.begin(), tests.end());
+    for (size_t testIndex : tests) {
+      shards[shardIndex].testNames.push_back(testNames[testIndex]);
+    }
+  }
+  return shards;
+}
+
+std::vector<std::string>
+ShardedExecution::parseDevices(const std::string &devices) {
+  std::vector<std::string> result{};
+  std::istringstream stream{devices};
+  std::string device{};
+  while (std::getline(stream, device, ',')) {
+    if (!device.empty()) {
+      result.push_back(device);
+    }
+  }
+  return result;
+}
+
+static bool matchesPattern(const char *name, const char *pattern) {
+  switch (*pattern) {
+  case '\0':
+  case ':':
+    return *name == '\0';
+  case '?':
+    return *name != '\0' && matchesPattern(name + 1, pattern + 1);
+  case '*':
+    return (*name != '\0' && matchesPattern(name + 1, pattern)) ||
+           matchesPattern(name, pattern + 1);
+  default:
+    return *pattern == *name && matchesPattern(name + 1, pattern + 1);
+  }
+}
+
+static bool matchesAnyPattern(const std::string &name,
+                              const std::string &patterns) {
+  for (size_t begin = 0; begin <= patterns.size();) {
+    if (matchesPattern(name.c_str(), patterns.c_str() + begin)) {
+      return true;
+    }
+    const size_t separator = patterns.find(':', begin);
+    if (separator == std::string::npos) {
+      break;
+    }
+    begin = separator + 1;
+  }
+  return false;
+}
+
+bool ShardedExecution::matchesGtestFilter(const std::string &testName,
+                                          const std::string &filter) {
+  const size_t dash = filter.find('-');
+  std::string positive = filter.substr(0, dash);
+  const std::string negative =
+      dash == std::string::npos ? "" : filter.substr(dash + 1);
+  if (positive.empty()) {
+    positive = "*";
+  }
+  return matchesAnyPattern(testName, positive) &&
+         (negative.empty() || !matchesAnyPattern(testName, negative));
+}
+
+// Every field is stored as its length followed by a colon and its contents,
+// so the output of tests does not need any escaping
+static void writeField(std::ostream &stream, const std::string &field) {
+  stream << field.size() << ':' << field;
+}
+
+static bool readField(const std::string &data, size_t &position,
+                      std::string &outField) {
+  const size_t colon = data.find(':', position);
+  if (colon == std::string::npos || colon == position) {
+    return false;
+  }
+  const std::string sizeString = data.substr(position, colon - position);
+  if (sizeString.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  const size_t size = std::stoull(sizeString);
+  if (size > data.size() - colon - 1) {
+    return false;
+  }
+  outField = data.substr(colon + 1, size);
+  position = colon + 1 + size;
+  return true;
+}
+
+std::string ShardedExecution::serializeRecord(const TestRecord &record) {
+  std::ostringstream result{};
+  writeField(result, record.testName);
+  writeField(result, std::to_string(record.milliseconds));
+  writeField(result, record.output);
+  writeField(result, record.errors);
+  return result.str();
+}
+
+bool ShardedExecution::deserializeRecords(const std::string &data,
+                                          std::vector<TestRecord> &outRecords) {
+  // Record being written when the worker crashed is incomplete, but all
+  // preceding records are still returned
+  size_t position = 0;
+  while (position < data.size()) {
+    TestRecord record{};
+    std::string milliseconds{};
+    if (!readField(data, position, record.testName) ||
+        !readField(data, position, milliseconds) ||
+        !readField(data, position, record.output) ||
+        !readField(data, position, record.errors)) {
+      return false;
+    }
+    record.milliseconds = std::atof(milliseconds.c_str());
+    outRecords.push_back(std::move(record));
+  }
+  return true;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Splits tests of all-tests mode between worker processes started with
+// --shards, e.g. one per device or tile selected with --devices. Shards are
+// balanced by runtimes measured in previous runs, which are kept in the file
+// given with --shardTimes. Tests without a known runtime are assumed to take
+// as long as an average known test.
+//
+// Every worker writes a record for each executed test to its own results
+// file. The parent merges records of all workers into a single report, which
+// is ordered the same way as in a serial run.
+class ShardedExecution {
+public:
+  // Milliseconds taken by each test, identified by its full googletest name
+  using Runtimes = std::map<std::string, double>;
+
+  struct Shard {
+    std::string device = {};
+    std::vector<std::string> testNames = {};
+    double expectedMilliseconds = 0;
+  };
+
+  struct TestRecord {
+    std::string testName = {};
+    double milliseconds = 0;
+    std::string output = {};
+    std::string errors = {};
+  };
+
+  // Missing file is not an error, it is created after the first run
+  static bool loadRuntimes(const std::string &filePath, Runtimes &outRuntimes,
+                           std::string &outErrorMessage);
+  static bool saveRuntimes(const std::string &filePath,
+                           const Runtimes &runtimes);
+
+  // Assigns each test to the least loaded shard, starting from the longest
+  // ones. Tests keep their original order within a shard. Devices are
+  // assigned to shards in turn. Empty device means all devices are visible.
+  static std::vector<Shard> partition(const std::vector<std::string> &testNames,
+                                      const Runtimes &runtimes,
+                                      size_t shardsCount,
+                                      const std::vector<std::string> &devices);
+
+  static std::vector<std::string> parseDevices(const std::string &devices);
+
+  // Same syntax as --gtest_filter, e.g. "*Copy*:*Fill*-*Image*"
+  static bool matchesGtestFilter(const std::string &testName,
+                                 const std::string &filter);
+
+  static std::string serializeRecord(const TestRecord &record);
+  static bool deserializeRecords(const std::string &data,
+                                 std::vector<TestRecord> &outRecords);
+};
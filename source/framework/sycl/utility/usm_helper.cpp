@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "framework/sycl/utility/usm_helper.h"
 
+#include "framework/utility/host_allocator.h"
+
 namespace SYCL::UsmHelper {
 
 void *allocate(UsmMemoryPlacement placement, const Sycl &sycl, size_t size) {
@@ -18,7 +20,7 @@ void *allocate(UsmMemoryPlacement placement, const Sycl &sycl, size_t size) {
   case UsmMemoryPlacement::Shared:
     return sycl::malloc_shared(size, sycl.queue);
   case UsmMemoryPlacement::NonUsm:
-    return std::malloc(size);
+    return HostAllocator::allocate(size);
   default:
     FATAL_ERROR("Unknown placement");
   }
@@ -53,7 +55,7 @@ void *allocateAligned(UsmMemoryPlacement placement, const Sycl &sycl,
   case UsmMemoryPlacement::Shared:
     return sycl::aligned_alloc_shared(alignment, size, sycl.queue);
   case UsmMemoryPlacement::NonUsm:
-    return std::aligned_alloc(alignment, size);
+    return HostAllocator::allocate(size, alignment);
   default:
     FATAL_ERROR("Unknown placement");
   }
@@ -80,7 +82,7 @@ void *allocateAligned(UsmRuntimeMemoryPlacement runtimePlacement,
 
 void deallocate(UsmMemoryPlacement placement, const Sycl &sycl, void *buffer) {
   if (placement == UsmMemoryPlacement::NonUsm) {
-    std::free(buffer);
+    HostAllocator::free(buffer);
   } else {
     sycl::free(buffer, sycl.queue);
   }
@@ -7,18 +7,21 @@
 
 #pragma once
 #include "framework/benchmark_info.h"
+#include "framework/interleaved_execution.h"
 #include "framework/supported_apis.h"
 #include "framework/test_case/test_case_argument_container.h"
 #include "framework/test_case/test_case_base.h"
 #include "framework/test_case/test_case_statistics.h"
 #include "framework/test_case/test_result.h"
 #include "framework/test_map.h"
+#include "framework/utility/checkpoint_journal.h"
 #include "framework/utility/common_help_message.h"
 #include "framework/utility/error.h"
 #include "framework/utility/string_utils.h"
 
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <type_traits>
 
@@ -57,41 +60,16 @@ public:
     return implementations[static_cast<int>(api)].function != nullptr;
   }
 
-  bool runFromCommandLine(CommandLineArguments &commandLineArguments) override {
-    // Parse test-specific parameters
+  bool runFromCommandLine(CommandLineArguments &commandLineArguments,
+                          bool printColumnNames) override {
     ArgumentContainerT arguments;
-    bool error = false;
-    if (!parseArguments(arguments, commandLineArguments)) {
-      return false;
-    }
-
-    // Check if all command line arguments were processed (no ignoring)
-    if (const auto unprocessedArgs =
-            CommandLineArgument::getUnprocessedArguments(commandLineArguments);
-        !unprocessedArgs.empty()) {
-      const auto getKey =
-          +[](const CommandLineArgument *a) { return a->getKey(); };
-      std::cerr << CommonHelpMessage::errorIgnoredCommandLineArgs()
-                << joinStrings(", ", unprocessedArgs, getKey) << std::endl;
-      error = true;
-    }
-
-    // Check if all test case arguments were set (no defaults)
-    if (const auto unparsedArgs = arguments.getUnparsedArguments();
-        !unparsedArgs.empty()) {
-      const auto getKey = +[](const Argument *a) { return a->getKey(); };
-      std::cerr << CommonHelpMessage::errorUnsetArguments()
-                << joinStrings(", ", unparsedArgs, getKey) << std::endl;
-      error = true;
-    }
-
-    if (error) {
+    if (!parseFromCommandLine(arguments, commandLineArguments)) {
       return false;
     }
 
     // Try running with all possible APIs. If some are disabled, e.g. --api=ocl
     // is passed, then the rest will be skipped in run() method
-    if (!Configuration::get().noColumnNames) {
+    if (printColumnNames) {
       TestCaseStatistics::printStatisticsHeader(Configuration::get().printType);
     }
     for (int apiIndex = static_cast<int>(Api::FIRST);
@@ -102,9 +80,32 @@ public:
     return true;
   }
 
+  bool validateFromCommandLine(
+      CommandLineArguments &commandLineArguments) const override {
+    ArgumentContainerT arguments;
+    if (!parseFromCommandLine(arguments, commandLineArguments)) {
+      return false;
+    }
+
+    // Values are checked the same way as before running, with any API which
+    // has an implementation
+    arguments.iterations = Configuration::get().iterations;
+    for (Api api : getApisWithImplementation()) {
+      arguments.api = api;
+      if (arguments.validateArguments()) {
+        return true;
+      }
+    }
+    std::cerr << "Invalid values of arguments\n";
+    return false;
+  }
+
   void run(ArgumentContainerT &arguments) const {
     arguments.iterations = Configuration::get().iterations;
     arguments.noIntelExtensions = Configuration::get().noIntelExtensions;
+    if (InterleavedExecution::get().isEnabled() && addToRounds(arguments)) {
+      return;
+    }
 
     // Create statistics object
     const auto testCaseNameWithConfig = getTestCaseNameWithConfig(
@@ -112,13 +113,31 @@ public:
     TestCaseStatistics statistics{arguments.iterations,
                                   Configuration::get().printType};
 
-    // Run test
+    // Run test. Journal entry left pending by a previous test, which threw an
+    // exception, is not finished, so it is reported as crashed after resuming.
+    resetHostStateOfTest();
+    CheckpointJournal::get().discardPendingEntry();
     const auto testResult =
         runImpl(statistics, arguments, testCaseNameWithConfig);
+    const auto testCaseNameWithHostState = getTestCaseNameWithHostState(
+        testCaseNameWithConfig, Configuration::get().dumpCommandLines);
+
+    // Print results. They are also recorded in the journal, if it is enabled
+    CheckpointJournal::OutputCapture outputCapture{};
+    printResults(testResult, statistics, arguments, testCaseNameWithConfig,
+                 testCaseNameWithHostState);
+    recordInJournal(testResult, statistics, outputCapture.release());
+  }
+
+private:
+  void printResults(TestResult testResult, const TestCaseStatistics &statistics,
+                    const ArgumentContainerT &arguments,
+                    const std::string &testCaseNameWithConfig,
+                    const std::string &testCaseNameWithHostState) const {
     if (testResult == TestResult::Success) {
       DEVELOPER_WARNING_IF(!statistics.isFull(),
                            "test did not generate as many values as expected");
-      statistics.printStatistics(testCaseNameWithConfig);
+      statistics.printStatistics(testCaseNameWithHostState);
     } else if (testResult == TestResult::Nooped) {
       statistics.printStatistics(testCaseNameWithConfig);
     } else {
@@ -144,7 +163,90 @@ public:
     }
   }
 
-private:
+  // Defers the config to rounds selected with --rounds. Test case objects
+  // created by tests are temporary, so the one from the test map is used.
+  bool addToRounds(const ArgumentContainerT &arguments) const {
+    const auto &testMap = TestMap::get();
+    const auto testMapEntry = testMap.find(getTestCaseName());
+    const TestCase *testCase =
+        testMapEntry != testMap.end()
+            ? dynamic_cast<const TestCase *>(testMapEntry->second.get())
+            : nullptr;
+    if (testCase == nullptr) {
+      return false;
+    }
+
+    struct RoundsState {
+      explicit RoundsState(size_t iterations)
+          : statistics(iterations, Configuration::get().printType) {}
+      ArgumentContainerT arguments = {};
+      TestCaseStatistics statistics;
+      TestResult testResult = TestResult::Success;
+      std::string testCaseNameWithConfig = {};
+      std::string testCaseNameWithHostState = {};
+    };
+    auto state = std::make_shared<RoundsState>(arguments.iterations);
+    copyArguments(arguments, state->arguments);
+    state->testCaseNameWithConfig = getTestCaseNameWithConfig(
+        arguments, Configuration::get().dumpCommandLines);
+
+    // Samples of all rounds are pushed to the same statistics. Exceptions
+    // are not caught by googletest anymore, so they end the config as errors.
+    InterleavedExecution::Config config{};
+    config.runRound = [testCase, state](size_t iterations) {
+      state->arguments.iterations = iterations;
+      resetHostStateOfTest();
+      try {
+        state->testResult =
+            testCase->runImpl(state->statistics, state->arguments,
+                              state->testCaseNameWithConfig);
+      } catch (const std::exception &) {
+        state->testResult = TestResult::Error;
+      }
+      state->testCaseNameWithHostState = getTestCaseNameWithHostState(
+          state->testCaseNameWithConfig, Configuration::get().dumpCommandLines);
+      return state->testResult == TestResult::Success;
+    };
+    config.printResults = [testCase, state]() {
+      testCase->printResults(state->testResult, state->statistics,
+                             state->arguments, state->testCaseNameWithConfig,
+                             state->testCaseNameWithHostState);
+    };
+    InterleavedExecution::get().addConfig(std::move(config));
+    return true;
+  }
+
+  static bool parseFromCommandLine(ArgumentContainerT &arguments,
+                                   CommandLineArguments &commandLineArguments) {
+    // Parse test-specific parameters
+    bool error = false;
+    if (!parseArguments(arguments, commandLineArguments)) {
+      return false;
+    }
+
+    // Check if all command line arguments were processed (no ignoring)
+    if (const auto unprocessedArgs =
+            CommandLineArgument::getUnprocessedArguments(commandLineArguments);
+        !unprocessedArgs.empty()) {
+      const auto getKey =
+          +[](const CommandLineArgument *a) { return a->getKey(); };
+      std::cerr << CommonHelpMessage::errorIgnoredCommandLineArgs()
+                << joinStrings(", ", unprocessedArgs, getKey) << std::endl;
+      error = true;
+    }
+
+    // Check if all test case arguments were set (no defaults)
+    if (const auto unparsedArgs = arguments.getUnparsedArguments();
+        !unparsedArgs.empty()) {
+      const auto getKey = +[](const Argument *a) { return a->getKey(); };
+      std::cerr << CommonHelpMessage::errorUnsetArguments()
+                << joinStrings(", ", unparsedArgs, getKey) << std::endl;
+      error = true;
+    }
+
+    return !error;
+  }
+
   TestResult runImpl(TestCaseStatistics &statistics,
                      const ArgumentContainerT &arguments,
                      const std::string &testCaseNameWithConfig) const {
@@ -195,6 +297,11 @@ private:
       printTestCaseNameLengthWarning(testCaseNameWithConfig);
     }
 
+    // Check if the test has already finished in a previous run
+    if (TestResult journalResult{}; findInJournal(arguments, journalResult)) {
+      return journalResult;
+    }
+
     // Run the test
     if (Configuration::get().interactivePrints) {
       // This will print test name before running the actual test along with
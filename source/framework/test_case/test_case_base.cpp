@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,10 @@
 #include "framework/benchmark_info.h"
 #include "framework/configuration.h"
 #include "framework/test_case/test_case_argument_container.h"
+#include "framework/test_case/test_case_statistics.h"
+#include "framework/utility/checkpoint_journal.h"
+#include "framework/utility/host_allocator.h"
+#include "framework/utility/host_cache.h"
 
 bool TestCaseBase::parseArguments(TestCaseArgumentContainer &arguments,
                                   CommandLineArguments &commandLineArguments) {
@@ -57,6 +61,89 @@ std::string TestCaseBase::getTestCaseNameWithConfig(
   return result.str();
 }
 
+void TestCaseBase::copyArguments(const TestCaseArgumentContainer &source,
+                                 TestCaseArgumentContainer &destination) {
+  std::vector<std::string> tokens{};
+  for (const Argument *argument : source.getArguments()) {
+    tokens.push_back("--" + argument->toString());
+  }
+  CommandLineArguments commandLineArguments{};
+  std::string errorMessage{};
+  FATAL_ERROR_IF(!CommandLineArgument::parseArguments(
+                     tokens, commandLineArguments, errorMessage) ||
+                     !destination.parseArguments(commandLineArguments),
+                 "Cannot copy arguments of a test. ", errorMessage);
+
+  destination.api = source.api;
+  destination.iterations = source.iterations;
+  destination.noIntelExtensions = source.noIntelExtensions;
+  destination.isSingleTestMode = source.isSingleTestMode;
+}
+
+void TestCaseBase::resetHostStateOfTest() {
+  HostAllocator::resetEffectivePageSize();
+  HostCache::resetAppliedState();
+}
+
+std::string TestCaseBase::getTestCaseNameWithHostState(
+    const std::string &testCaseNameWithConfig, bool commandLine) {
+  if (commandLine) {
+    return testCaseNameWithConfig;
+  }
+
+  // Host state is appended to the config, before its closing parenthesis
+  std::string hostState{};
+  const std::string hostPages = HostAllocator::getEffectivePageSize();
+  if (!hostPages.empty() && Configuration::get().hostAllocationPolicy !=
+                                HostAllocationPolicy::Default) {
+    hostState += " hostPages=" + hostPages;
+  }
+  if (const std::string hostCache = HostCache::getAppliedState();
+      !hostCache.empty()) {
+    hostState += " hostCache=" + hostCache;
+  }
+  std::string result = testCaseNameWithConfig;
+  result.insert(result.size() - 1, hostState);
+  return result;
+}
+
+bool TestCaseBase::findInJournal(const TestCaseArgumentContainer &arguments,
+                                 TestResult &outTestResult) const {
+  CheckpointJournal &journal = CheckpointJournal::get();
+  if (!journal.isEnabled()) {
+    return false;
+  }
+
+  const std::string key = getTestCaseNameWithConfig(arguments, true);
+  const CheckpointJournal::Entry *entry = journal.findCompleted(key);
+  if (entry == nullptr) {
+    journal.recordStart(key);
+    return false;
+  }
+  if (entry->finished) {
+    std::cout << entry->output << std::flush;
+    outTestResult = TestResult::Resumed;
+  } else {
+    outTestResult = TestResult::Crashed;
+  }
+  return true;
+}
+
+void TestCaseBase::recordInJournal(TestResult testResult,
+                                   const TestCaseStatistics &statistics,
+                                   const std::string &output) {
+  CheckpointJournal &journal = CheckpointJournal::get();
+  if (!journal.hasPendingEntry()) {
+    return;
+  }
+
+  const std::string status =
+      testResult == TestResult::Success
+          ? "SUCCESS"
+          : TestResultHelper::getTestResultInfo(testResult).stringMessage;
+  journal.recordFinish(status, statistics.getSamplesString(), output);
+}
+
 bool TestCaseBase::matchesWithTestFilter() const {
   for (const std::string &testFilter : Configuration::get().testFilter.get()) {
     const auto testCaseName = getTestCaseName();
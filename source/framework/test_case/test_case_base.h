@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 
 #include "framework/enum/api.h"
 #include "framework/test_case/test_case_interface.h"
+#include "framework/test_case/test_result.h"
 
 struct TestCaseArgumentContainer;
+class TestCaseStatistics;
 
 // This class implements test-agnostic functionality of the TestCase class. All
 // methods, which do not require a concrete TestCaseArgument class for a
@@ -24,6 +26,26 @@ protected:
   getTestCaseNameWithConfig(const TestCaseArgumentContainer &arguments,
                             bool commandLine) const;
 
+  // Arguments refer to their container, so they are copied through their
+  // command-line form
+  static void copyArguments(const TestCaseArgumentContainer &source,
+                            TestCaseArgumentContainer &destination);
+
+  // Records pages and cache state of host buffers used during the test, when
+  // they are selected with --hostAllocationPolicy and --hostCacheState
+  static void resetHostStateOfTest();
+  static std::string
+  getTestCaseNameWithHostState(const std::string &testCaseNameWithConfig,
+                               bool commandLine);
+
+  // Configs are recorded in the journal selected with --resume. Configs, which
+  // finished or crashed too many times in previous runs, are not executed.
+  bool findInJournal(const TestCaseArgumentContainer &arguments,
+                     TestResult &outTestResult) const;
+  static void recordInJournal(TestResult testResult,
+                              const TestCaseStatistics &statistics,
+                              const std::string &output);
+
   // Filters
   bool matchesWithTestFilter() const;
   bool matchesWithArgFilter(const ArgumentContainer &arguments) const;
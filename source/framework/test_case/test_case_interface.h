@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,8 +16,10 @@ struct ArgumentContainer;
 
 struct TestCaseInterface {
   virtual ~TestCaseInterface() = default;
+  virtual bool runFromCommandLine(CommandLineArguments &commandLineArguments,
+                                  bool printColumnNames) = 0;
   virtual bool
-  runFromCommandLine(CommandLineArguments &commandLineArguments) = 0;
+  validateFromCommandLine(CommandLineArguments &commandLineArguments) const = 0;
   virtual bool isApiImplemented(Api api) const = 0;
   virtual std::vector<Api> getApisWithImplementation() const = 0;
   virtual std::unique_ptr<ArgumentContainer> getArguments() const = 0;
@@ -15,7 +15,9 @@
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <sstream>
 #include <type_traits>
 
 TestCaseStatistics::TestCaseStatistics(size_t maxSamplesCount,
@@ -133,6 +135,15 @@ void TestCaseStatistics::pushUnitAndType(MeasurementUnit unit,
   this->noopSample.type = type;
 }
 
+void TestCaseStatistics::pushSetupValue(Clock::duration time,
+                                        MeasurementUnit unit,
+                                        MeasurementType type,
+                                        const std::string &description) {
+  FATAL_ERROR_IF(description.empty(), "Setup values have to be labeled");
+  setupDescriptions.insert(description);
+  pushValue(time, unit, type, description);
+}
+
 bool TestCaseStatistics::isEmpty() const {
   for (auto &samplesEntry : samplesMap) {
     if (samplesEntry.second.vector.size() != 0) {
@@ -146,13 +157,29 @@ bool TestCaseStatistics::isFull() const {
   DEVELOPER_WARNING_IF(samplesMap.size() == 0,
                        "Test did not generate any values");
   for (auto &samplesEntry : samplesMap) {
-    if (samplesEntry.second.vector.size() != maxSamplesCount) {
+    if (samplesEntry.second.vector.size() !=
+        getExpectedSamplesCount(samplesEntry.first)) {
       return false;
     }
   }
   return true;
 }
 
+std::string TestCaseStatistics::getSamplesString() const {
+  std::ostringstream result{};
+  result << std::setprecision(std::numeric_limits<Value>::max_digits10);
+  for (const auto &[description, samples] : samplesMap) {
+    if (result.tellp() > 0) {
+      result << ';';
+    }
+    result << description << std::to_string(samples.unit) << '=';
+    for (auto i = 0u; i < samples.vector.size(); i++) {
+      result << (i > 0 ? "," : "") << samples.vector[i];
+    }
+  }
+  return result.str();
+}
+
 void TestCaseStatistics::overrideMeasurementUnit(MeasurementUnit &unit) {
   if (unit == MeasurementUnit::GigabytesPerSecond &&
       Configuration::get().doNotPrintBandwidth) {
@@ -170,7 +197,7 @@ void TestCaseStatistics::pushValue(Value value, const std::string &description,
   auto &samples = this->samplesMap[description];
 
   // We expect a precise amount of measurements requested by the user.
-  FATAL_ERROR_IF(samples.vector.size() == maxSamplesCount,
+  FATAL_ERROR_IF(samples.vector.size() == getExpectedSamplesCount(description),
                  "Too many values pushed by the test");
 
   // Set unit and type for the samples
@@ -191,6 +218,11 @@ void TestCaseStatistics::pushValue(Value value, const std::string &description,
   }
 }
 
+size_t TestCaseStatistics::getExpectedSamplesCount(
+    const std::string &description) const {
+  return setupDescriptions.count(description) > 0 ? 1u : maxSamplesCount;
+}
+
 struct ColumnInfo {
   int width;
   const char *label;
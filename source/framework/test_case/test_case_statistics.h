@@ -11,6 +11,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 
 class TestCaseStatistics : public Statistics {
@@ -42,10 +43,16 @@ public:
   void pushEnergy(double watts, MeasurementUnit unit, MeasurementType type,
                   const std::string &description = "") override;
   void pushUnitAndType(MeasurementUnit unit, MeasurementType type) override;
+  void pushSetupValue(Clock::duration time, MeasurementUnit unit,
+                      MeasurementType type,
+                      const std::string &description) override;
 
   bool isEmpty() const override;
   bool isFull() const override;
 
+  // All samples in a single line, e.g. "[ns]=1.5,1.25;Setup[us]=3"
+  std::string getSamplesString() const;
+
   static void printStatisticsHeader(Configuration::PrintType printType);
   void printStatisticsBeforeTest(const std::string &testCaseName) const;
   void printClearLineAfterTest() const;
@@ -58,6 +65,7 @@ private:
   static void overrideMeasurementUnit(MeasurementUnit &unit);
   void pushValue(Value value, const std::string &description,
                  MeasurementUnit unit, MeasurementType type);
+  size_t getExpectedSamplesCount(const std::string &description) const;
   void printStatisticsDefault(const std::string &testCaseName) const;
   void printStatisticsNoop(const std::string &testCaseName) const;
   void printStatisticsCsv(const std::string &testCaseName) const;
@@ -65,6 +73,7 @@ private:
 
   const Configuration::PrintType printType;
   SamplesMap samplesMap = {};
+  std::set<std::string> setupDescriptions = {};
   Samples noopSample = {};
   bool reachedInfinity = false;
 
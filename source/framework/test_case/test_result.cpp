@@ -26,6 +26,10 @@ const static std::unordered_map<TestResult, TestResultHelper::TestResultInfo> te
     {TestResult::FilteredOut,             { "FILTERED_OUT",        true ,        false,     true,    false} },
     {TestResult::VerificationFail,        { "VERIF_FAIL",          true ,        true ,     false,   true } },
     {TestResult::KernelBuildError,        { "KERNEL_BUILD_ERROR",  true ,        true ,     false,   true } },
+    {TestResult::ChildProcessCrashed,     { "CHILD_CRASHED",       true ,        true ,     false,   true } },
+    {TestResult::ChildProcessTimeout,     { "CHILD_TIMEOUT",       true ,        true ,     false,   true } },
+    {TestResult::Resumed,                 { "RESUMED",             false,        false,     true,    false} },
+    {TestResult::Crashed,                 { "CRASHED",             true ,        true ,     false,   true } },
 };
 // clang-format on
 
@@ -31,7 +31,11 @@ enum class TestResult {
   Nooped,           // Test was nooped, only print its name
   FilteredOut,      // Test was skipped because of passed argFilter
   VerificationFail, // Results where incorrect
-  KernelBuildError  // Kernel could not be compiled
+  KernelBuildError, // Kernel could not be compiled
+  ChildProcessCrashed, // Child process of the test was killed by a signal
+  ChildProcessTimeout, // Child process did not finish before --processTimeout
+  Resumed, // Test finished in a previous run recorded in the --resume journal
+  Crashed  // Test crashed in previous runs recorded in the --resume journal
 };
 
 struct TestResultHelper {
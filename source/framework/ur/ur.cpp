@@ -9,10 +9,45 @@
 
 #include "error.h"
 
+#include "framework/utility/context_cache.h"
+
 #include <stdexcept>
 #include <vector>
 
+using HandlesCache = ContextCache<UrState::HandlesKey, UrState::Handles>;
+
+static HandlesCache &getHandlesCache() {
+  static HandlesCache cache{Configuration::get().reuseContexts,
+                            UrState::destroyHandles};
+  return cache;
+}
+
+static UrState::HandlesKey getHandlesKey() {
+  return {Configuration::get().urPlatformIndex,
+          Configuration::get().urDeviceIndex};
+}
+
 UrState::UrState() {
+  const Handles handles =
+      getHandlesCache().acquire(getHandlesKey(), false, createHandles);
+  adapter = handles.adapter;
+  platform = handles.platform;
+  context = handles.context;
+  device = handles.device;
+}
+
+UrState::~UrState() {
+  getHandlesCache().release(getHandlesKey(),
+                            {adapter, platform, context, device});
+}
+
+UrState::Handles UrState::createHandles() {
+  Handles handles{};
+  ur_adapter_handle_t &adapter = handles.adapter;
+  ur_platform_handle_t &platform = handles.platform;
+  ur_context_handle_t &context = handles.context;
+  ur_device_handle_t &device = handles.device;
+
   ur_device_init_flags_t device_flags = 0;
   EXPECT_UR_RESULT_SUCCESS(urLoaderInit(device_flags, nullptr));
 
@@ -56,24 +91,25 @@ UrState::UrState() {
   }
   device = devices[Configuration::get().urDeviceIndex];
 
-  for (auto &device : devices) {
-    if (device != this->device) {
-      urDeviceRelease(device);
+  for (auto &otherDevice : devices) {
+    if (otherDevice != device) {
+      urDeviceRelease(otherDevice);
     }
   }
 
   EXPECT_UR_RESULT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+  return handles;
 }
 
-UrState::~UrState() {
-  if (device) {
-    urDeviceRelease(device);
+void UrState::destroyHandles(Handles &handles) {
+  if (handles.device) {
+    urDeviceRelease(handles.device);
   }
-  if (context) {
-    urContextRelease(context);
+  if (handles.context) {
+    urContextRelease(handles.context);
   }
-  if (adapter) {
-    urAdapterRelease(adapter);
+  if (handles.adapter) {
+    urAdapterRelease(handles.adapter);
   }
   urLoaderTearDown();
 }
@@ -10,6 +10,7 @@
 #include "framework/configuration.h"
 
 #include <ur_api.h>
+#include <utility>
 
 struct UrState {
   UrState();
@@ -19,4 +20,16 @@ struct UrState {
   ur_platform_handle_t platform;
   ur_context_handle_t context;
   ur_device_handle_t device;
+
+  // Handles are given to the ContextCache in the destructor, so with
+  // --reuseContexts following tests do not initialize the loader again
+  struct Handles {
+    ur_adapter_handle_t adapter{};
+    ur_platform_handle_t platform{};
+    ur_context_handle_t context{};
+    ur_device_handle_t device{};
+  };
+  using HandlesKey = std::pair<size_t, size_t>;
+  static Handles createHandles();
+  static void destroyHandles(Handles &handles);
 };
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/aligned_allocator.h"
+
+#include "framework/utility/host_allocator.h"
+
+void *alloc2MBAligned(size_t size) {
+  return HostAllocator::allocate(alignUp(size, sizeOf2MB), sizeOf2MB,
+                                 HostAllocationPolicy::TransparentHugePages);
+}
+
+void free2MBAligned(void *buffer) { HostAllocator::free(buffer); }
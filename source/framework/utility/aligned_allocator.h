@@ -5,6 +5,8 @@
  *
  */
 
+#pragma once
+
 #include <cstddef>
 
 constexpr inline size_t alignUp(size_t before, size_t alignment) {
@@ -14,4 +16,5 @@ constexpr inline size_t alignUp(size_t before, size_t alignment) {
 
 const auto sizeOf2MB = 2 * 1024 * 1024;
 
-void *alloc2MBAligned(size_t size);
\ No newline at end of file
+void *alloc2MBAligned(size_t size);
+void free2MBAligned(void *buffer);
\ No newline at end of file
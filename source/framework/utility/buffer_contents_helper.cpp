@@ -7,12 +7,49 @@
 
 #include "framework/utility/buffer_contents_helper.h"
 
+#include "framework/configuration.h"
+#include "framework/utility/aligned_allocator.h"
 #include "framework/utility/error.h"
+#include "framework/utility/memory_constants.h"
+#include "framework/utility/thread_team.h"
 
+#include <algorithm>
 #include <cstring>
+#include <random>
 
-std::mt19937 BufferContentsHelper::generator{std::random_device{}()};
-std::vector<uint8_t> BufferContentsHelper::cachedRandomData{};
+// Generation loops are written lane by lane, so the compiler vectorizes them.
+// Where supported, a clone for wider vectors is selected at runtime.
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__linux__)
+#define FILL_TARGET_CLONES                                                     \
+  __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define FILL_TARGET_CLONES
+#endif
+
+// Parts filled by different threads start at multiples of this size, which is
+// also the largest span of a single run
+constexpr static size_t partGranularity = 64 * MemoryConstants::kiloByte;
+constexpr static size_t parallelFillThreshold = 16 * MemoryConstants::megaByte;
+constexpr static size_t wordsPerBlock = 512;
+
+constexpr static uint64_t golden = 0x9E3779B97F4A7C15ull;
+constexpr static uint64_t runsStream = 0xD1B54A32D192ED03ull;
+
+// Counter-based generator: the SplitMix64 finalizer applied to the counter
+static inline uint64_t randomWord(uint64_t seed, uint64_t counter) {
+  uint64_t value = seed + (counter + 1) * golden;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+
+FILL_TARGET_CLONES
+static void generateWords(uint64_t *words, size_t count, uint64_t seed,
+                          uint64_t firstCounter, uint64_t mask) {
+  for (size_t i = 0; i < count; i++) {
+    words[i] = randomWord(seed, firstCounter + i) & mask;
+  }
+}
 
 void BufferContentsHelper::fill(uint8_t *buffer, size_t size,
                                 BufferContents contents) {
@@ -23,50 +60,131 @@ void BufferContentsHelper::fill(uint8_t *buffer, size_t size,
     return fillWithRandomBytes(buffer, size);
   case BufferContents::IncreasingBytes:
     return fillWithIncreasingBytes(buffer, size);
+  case BufferContents::Runs:
+    return fillWithRuns(buffer, size, Configuration::get().contentsRunLength);
+  case BufferContents::Entropy:
+    return fillWithEntropy(buffer, size,
+                           Configuration::get().contentsEntropyBits);
   default:
     FATAL_ERROR("Unknown buffer contents");
   }
 }
 
 void BufferContentsHelper::fillWithZeros(uint8_t *buffer, size_t size) {
-  std::memset(buffer, 0, size);
+  fillInParts(size, [&](size_t begin, size_t end) {
+    std::memset(buffer + begin, 0, end - begin);
+  });
 }
 
 void BufferContentsHelper::fillWithRandomBytes(uint8_t *buffer, size_t size) {
-  // We randomize OWORDS instead of BYTES, because it's faster. Size of the
-  // cachedRandomData must be aligned to sizeof(OWORD), so we don't have to
-  // handle generation of the dangling bytes.
-  const auto randomizationChunkSize = sizeof(uint64_t);
-  const auto alignedSize = (size + (randomizationChunkSize - 1)) /
-                           randomizationChunkSize * randomizationChunkSize;
-
-  // If requested size is greater than what we've cached, generate more data
-  const auto oldSize = cachedRandomData.size();
-  if (alignedSize > oldSize) {
-    cachedRandomData.resize(alignedSize);
-
-    const auto remainingSize = alignedSize - oldSize;
-    const auto numOwords = remainingSize / sizeof(uint64_t);
-
-    uint8_t *bufferIterator = cachedRandomData.data() + oldSize;
-    for (auto i = 0u; i < numOwords; i++) {
-      *reinterpret_cast<uint64_t *>(bufferIterator) = randomOword();
-      bufferIterator += sizeof(uint64_t);
-    }
-  }
-
-  // Copy cached data to desired buffer
-  std::memcpy(buffer, cachedRandomData.data(), size);
+  fillWithMaskedRandomWords(buffer, size, ~0ull);
 }
 
 void BufferContentsHelper::fillWithIncreasingBytes(uint8_t *buffer,
                                                    size_t size) {
-  for (auto index = 0u; index < size; index++) {
-    buffer[index] = static_cast<uint8_t>(index);
+  uint8_t pattern[256];
+  for (auto index = 0u; index < sizeof(pattern); index++) {
+    pattern[index] = static_cast<uint8_t>(index);
   }
+  fillWithPattern(buffer, size, pattern, sizeof(pattern));
+}
+
+void BufferContentsHelper::fillWithRuns(uint8_t *buffer, size_t size,
+                                        size_t meanRunLength) {
+  // Run lengths are uniform in [1, 2 * meanRunLength - 1]. Every granule
+  // starts a new run, so granules can be generated independently.
+  const uint64_t lengthsRange = std::max<size_t>(2 * meanRunLength - 1, 1);
+  const uint64_t seed = getSeed() ^ runsStream;
+  fillInParts(size, [&](size_t begin, size_t end) {
+    for (size_t granule = begin; granule < end; granule += partGranularity) {
+      const size_t granuleEnd = std::min(granule + partGranularity, end);
+      uint64_t counter = granule;
+      for (size_t position = granule; position < granuleEnd;) {
+        const uint64_t word = randomWord(seed, counter++);
+        const uint8_t value = static_cast<uint8_t>(word);
+        const size_t length =
+            1 + static_cast<size_t>((word >> 8) % lengthsRange);
+        const size_t runEnd = std::min(position + length, granuleEnd);
+        std::memset(buffer + position, value, runEnd - position);
+        position = runEnd;
+      }
+    }
+  });
+}
+
+void BufferContentsHelper::fillWithEntropy(uint8_t *buffer, size_t size,
+                                           size_t entropyBitsPerByte) {
+  // Every byte takes one of 2^entropyBitsPerByte values with equal
+  // probability, which bounds how well the buffer can be compressed
+  FATAL_ERROR_IF(entropyBitsPerByte > 8, "Invalid entropy of buffer contents");
+  const uint64_t byteMask = (1ull << entropyBitsPerByte) - 1;
+  fillWithMaskedRandomWords(buffer, size, byteMask * 0x0101010101010101ull);
 }
 
-uint64_t BufferContentsHelper::randomOword() {
-  const uint64_t result = std::uniform_int_distribution<uint64_t>{}(generator);
-  return result;
+void BufferContentsHelper::fillWithPattern(uint8_t *buffer, size_t size,
+                                           const uint8_t *pattern,
+                                           size_t patternSize) {
+  FATAL_ERROR_IF(patternSize == 0, "Empty pattern of buffer contents");
+
+  // Each part writes one tile of whole patterns and copies it over the rest
+  const size_t tileSize =
+      std::max<size_t>(4 * MemoryConstants::kiloByte / patternSize, 1) *
+      patternSize;
+  fillInParts(size, [&](size_t begin, size_t end) {
+    const size_t tileEnd = std::min(begin + tileSize, end);
+    for (size_t position = begin; position < tileEnd; position++) {
+      buffer[position] = pattern[position % patternSize];
+    }
+    for (size_t position = tileEnd; position < end; position += tileSize) {
+      std::memcpy(buffer + position, buffer + begin,
+                  std::min(tileSize, end - position));
+    }
+  });
+}
+
+uint64_t BufferContentsHelper::getSeed() {
+  static const uint64_t seed = []() -> uint64_t {
+    if (Configuration::isLoaded() && Configuration::get().seed >= 0) {
+      return static_cast<uint64_t>(Configuration::get().seed);
+    }
+    std::random_device device{};
+    return (static_cast<uint64_t>(device()) << 32) | device();
+  }();
+  return seed;
+}
+
+void BufferContentsHelper::fillInParts(size_t size, const PartJob &job) {
+  if (size < parallelFillThreshold || !Configuration::isLoaded()) {
+    job(0, size);
+    return;
+  }
+
+  ThreadTeam team{0};
+  team.run([&](size_t threadIndex, size_t threadsCount) {
+    const size_t partSize =
+        alignUp((size + threadsCount - 1) / threadsCount, partGranularity);
+    const size_t begin = std::min(threadIndex * partSize, size);
+    const size_t end = std::min(begin + partSize, size);
+    if (begin < end) {
+      job(begin, end);
+    }
+  });
+}
+
+void BufferContentsHelper::fillWithMaskedRandomWords(uint8_t *buffer,
+                                                     size_t size,
+                                                     uint64_t mask) {
+  const uint64_t seed = getSeed();
+  fillInParts(size, [&](size_t begin, size_t end) {
+    uint64_t words[wordsPerBlock];
+    for (size_t position = begin; position < end;
+         position += sizeof(words)) {
+      const size_t blockSize = std::min(sizeof(words), end - position);
+      const size_t wordsCount = (blockSize + sizeof(uint64_t) - 1) /
+                                sizeof(uint64_t);
+      generateWords(words, wordsCount, seed, position / sizeof(uint64_t),
+                    mask);
+      std::memcpy(buffer + position, words, blockSize);
+    }
+  });
 }
@@ -9,19 +9,30 @@
 
 #include "framework/enum/buffer_contents.h"
 
-#include <cstring>
-#include <random>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 
+// Generated contents depend only on --seed and the position in the buffer, so
+// they are the same regardless of how many threads fill the buffer and any
+// prefix of a buffer matches a shorter buffer filled with the same contents
 class BufferContentsHelper {
 public:
   static void fill(uint8_t *buffer, size_t size, BufferContents contents);
   static void fillWithZeros(uint8_t *buffer, size_t size);
   static void fillWithRandomBytes(uint8_t *buffer, size_t size);
   static void fillWithIncreasingBytes(uint8_t *buffer, size_t size);
+  static void fillWithRuns(uint8_t *buffer, size_t size, size_t meanRunLength);
+  static void fillWithEntropy(uint8_t *buffer, size_t size,
+                              size_t entropyBitsPerByte);
+  static void fillWithPattern(uint8_t *buffer, size_t size,
+                              const uint8_t *pattern, size_t patternSize);
 
-private:
-  static std::mt19937 generator;
-  static std::vector<uint8_t> cachedRandomData;
+  static uint64_t getSeed();
 
-  static uint64_t randomOword();
+private:
+  using PartJob = std::function<void(size_t begin, size_t end)>;
+  static void fillInParts(size_t size, const PartJob &job);
+  static void fillWithMaskedRandomWords(uint8_t *buffer, size_t size,
+                                        uint64_t mask);
 };
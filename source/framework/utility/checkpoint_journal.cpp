@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "checkpoint_journal.h"
+
+#include "framework/configuration.h"
+
+#include <fstream>
+#include <iterator>
+#include <unordered_set>
+#include <vector>
+
+// Every record is a single line with fields separated by tabs. Characters,
+// which would break the line apart, are escaped.
+static std::string escape(const std::string &field) {
+  std::string result{};
+  for (char c : field) {
+    switch (c) {
+    case '\\':
+      result += "\\\\";
+      break;
+    case '\t':
+      result += "\\t";
+      break;
+    case '\n':
+      result += "\\n";
+      break;
+    case '\r':
+      result += "\\r";
+      break;
+    default:
+      result += c;
+    }
+  }
+  return result;
+}
+
+static std::vector<std::string> splitRecord(const std::string &line) {
+  std::vector<std::string> fields{""};
+  for (size_t i = 0; i < line.size(); i++) {
+    if (line[i] == '\t') {
+      fields.emplace_back();
+    } else if (line[i] == '\\' && i + 1 < line.size()) {
+      const char c = line[++i];
+      fields.back() += c == 't' ? '\t' : c == 'n' ? '\n' : c == 'r' ? '\r' : c;
+    } else {
+      fields.back() += line[i];
+    }
+  }
+  return fields;
+}
+
+CheckpointJournal::OutputCapture::OutputCapture() {
+  if (CheckpointJournal::get().hasPendingEntry()) {
+    originalBuffer = std::cout.rdbuf(output.rdbuf());
+  }
+}
+
+CheckpointJournal::OutputCapture::~OutputCapture() { release(); }
+
+std::string CheckpointJournal::OutputCapture::release() {
+  if (originalBuffer != nullptr) {
+    std::cout.rdbuf(originalBuffer);
+    originalBuffer = nullptr;
+    std::cout << output.str();
+  }
+  return output.str();
+}
+
+CheckpointJournal &CheckpointJournal::get() {
+  const Configuration &configuration = Configuration::get();
+  static CheckpointJournal journal{
+      configuration.resume,
+      static_cast<const std::string &>(configuration.shardOutput).empty()};
+  return journal;
+}
+
+CheckpointJournal::CheckpointJournal(const std::string &filePath,
+                                     bool recoverCrashes)
+    : filePath(filePath) {
+  if (isEnabled()) {
+    load(recoverCrashes);
+  }
+}
+
+CheckpointJournal::~CheckpointJournal() {
+  if (fileHandle != -1) {
+    closeFile();
+  }
+}
+
+void CheckpointJournal::load(bool recoverCrashes) {
+  // Lines torn by a crash in the middle of writing them are ignored
+  std::unordered_set<std::string> startedKeys{};
+  std::ifstream file{filePath, std::ios::binary};
+  const std::string contents{std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>()};
+  file.close();
+  std::istringstream stream{contents};
+  std::string line{};
+  while (std::getline(stream, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const std::vector<std::string> fields = splitRecord(line);
+    if (fields[0] == "start" && fields.size() == 2) {
+      startedKeys.insert(fields[1]);
+    } else if (fields[0] == "finish" && fields.size() == 5) {
+      Entry &entry = entries[fields[1]];
+      entry.finished = true;
+      entry.status = fields[2];
+      entry.output = fields[4];
+      startedKeys.erase(fields[1]);
+    } else if (fields[0] == "crash" && fields.size() == 2) {
+      entries[fields[1]].crashesCount++;
+      startedKeys.erase(fields[1]);
+    }
+  }
+
+  openFile();
+  if (recoverCrashes) {
+    if (contents.empty()) {
+      writeToFile("# Journal of test configs. Pass it with --resume to skip "
+                  "finished configs\n");
+    } else if (contents.back() != '\n') {
+      writeToFile("\n");
+    }
+
+    // Configs, which started but never finished, crashed the previous run
+    for (const std::string &key : startedKeys) {
+      entries[key].crashesCount++;
+      appendRecord({"crash", key});
+    }
+  }
+  for (const auto &[key, entry] : entries) {
+    if (entry.finished) {
+      loadedCount++;
+    }
+  }
+}
+
+const CheckpointJournal::Entry *
+CheckpointJournal::findCompleted(const std::string &key) {
+  const auto it = entries.find(key);
+  if (it == entries.end()) {
+    return nullptr;
+  }
+  if (it->second.finished) {
+    resumedCount++;
+    return &it->second;
+  }
+  if (it->second.crashesCount >= maxCrashesCount) {
+    crashedCount++;
+    return &it->second;
+  }
+  return nullptr;
+}
+
+void CheckpointJournal::recordStart(const std::string &key) {
+  pendingKey = key;
+  appendRecord({"start", key});
+}
+
+void CheckpointJournal::recordFinish(const std::string &status,
+                                     const std::string &samples,
+                                     const std::string &output) {
+  if (pendingKey.empty()) {
+    return;
+  }
+  appendRecord({"finish", pendingKey, status, samples, output});
+  pendingKey.clear();
+}
+
+void CheckpointJournal::appendRecord(
+    std::initializer_list<std::string> fields) {
+  // Whole record is written at once, so records of worker processes sharing
+  // the journal are not interleaved
+  std::string record{};
+  for (const std::string &field : fields) {
+    record += (record.empty() ? "" : "\t") + escape(field);
+  }
+  writeToFile(record + '\n');
+}
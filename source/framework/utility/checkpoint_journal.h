@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+// Append-only file given with --resume, in which every executed test config
+// is recorded before it starts and after it finishes, along with its status,
+// samples and printed output. Each record is flushed to the disk right away,
+// so it survives crashes and hangs of the driver.
+//
+// When the run is repeated with the same journal, finished configs are not
+// executed again, their output is printed from the journal instead. Configs
+// which started, but never finished, are recorded as crashed and executed
+// again. Configs which crashed too many times are reported as crashed.
+//
+// Worker processes of --shards share the journal of their parent. Only the
+// parent recovers crashed configs, because unfinished configs seen by a worker
+// may still be running in other workers.
+class CheckpointJournal {
+public:
+  struct Entry {
+    bool finished = false;
+    std::string status = {};
+    std::string output = {};
+    size_t crashesCount = 0;
+  };
+
+  // Redirects the output of a test while it is being recorded in the journal.
+  // The output is still printed to the console, when it is released.
+  class OutputCapture {
+  public:
+    OutputCapture();
+    ~OutputCapture();
+    std::string release();
+
+  private:
+    std::ostringstream output = {};
+    std::streambuf *originalBuffer = nullptr;
+  };
+
+  constexpr static size_t maxCrashesCount = 2;
+
+  // Journal configured with --resume. It is disabled if the path is empty.
+  static CheckpointJournal &get();
+  CheckpointJournal(const std::string &filePath, bool recoverCrashes);
+  ~CheckpointJournal();
+  CheckpointJournal(const CheckpointJournal &) = delete;
+  CheckpointJournal &operator=(const CheckpointJournal &) = delete;
+
+  bool isEnabled() const { return !filePath.empty(); }
+  const std::string &getFilePath() const { return filePath; }
+
+  // Returns the entry of a config, which should not be executed again, e.g.
+  // because it has already finished
+  const Entry *findCompleted(const std::string &key);
+  void recordStart(const std::string &key);
+  void recordFinish(const std::string &status, const std::string &samples,
+                    const std::string &output);
+  bool hasPendingEntry() const { return !pendingKey.empty(); }
+  void discardPendingEntry() { pendingKey.clear(); }
+
+  size_t getLoadedCount() const { return loadedCount; }
+  size_t getResumedCount() const { return resumedCount; }
+  size_t getCrashedCount() const { return crashedCount; }
+
+private:
+  void load(bool recoverCrashes);
+  void appendRecord(std::initializer_list<std::string> fields);
+
+  // OS-specific methods
+  void openFile();
+  void writeToFile(const std::string &data);
+  void closeFile();
+
+  const std::string filePath;
+  std::unordered_map<std::string, Entry> entries = {};
+  std::string pendingKey = {};
+  int64_t fileHandle = -1;
+  size_t loadedCount = 0;
+  size_t resumedCount = 0;
+  size_t crashedCount = 0;
+};
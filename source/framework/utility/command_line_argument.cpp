@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "framework/utility/error.h"
 #include "framework/utility/string_utils.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 CommandLineArgument::CommandLineArgument(const char *token) {
@@ -19,14 +20,21 @@ CommandLineArgument::CommandLineArgument(const char *token) {
 bool CommandLineArgument::parseArguments(int argc, char **argv,
                                          CommandLineArguments &outArguments,
                                          std::string &outErrorMessage) {
+  const std::vector<std::string> tokens(argv + std::min(argc, 1), argv + argc);
+  return parseArguments(tokens, outArguments, outErrorMessage);
+}
+
+bool CommandLineArgument::parseArguments(
+    const std::vector<std::string> &tokens, CommandLineArguments &outArguments,
+    std::string &outErrorMessage) {
   std::unordered_set<std::string> allKeys = {};
 
-  for (int argIndex = 1; argIndex < argc; argIndex++) {
-    CommandLineArgument arg{argv[argIndex]};
+  for (const std::string &token : tokens) {
+    CommandLineArgument arg{token.c_str()};
 
     // Validate syntax
     if (!arg.isValid()) {
-      outErrorMessage = std::string("Argument \"") + argv[argIndex] +
+      outErrorMessage = std::string("Argument \"") + token +
                         "\" is ill-formed. All arguments have to follow "
                         "syntax: --<key>[=value]";
       outArguments.clear();
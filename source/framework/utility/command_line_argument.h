@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,9 @@ public:
   static bool parseArguments(int argc, char **argv,
                              CommandLineArguments &outArguments,
                              std::string &outErrorMessage);
+  static bool parseArguments(const std::vector<std::string> &tokens,
+                             CommandLineArguments &outArguments,
+                             std::string &outErrorMessage);
   static std::vector<const CommandLineArgument *>
   getUnprocessedArguments(const CommandLineArguments &arguments);
 
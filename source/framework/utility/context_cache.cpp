@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "context_cache.h"
+
+#include <algorithm>
+#include <mutex>
+
+static std::vector<ContextCacheBase *> &getCaches() {
+  static std::vector<ContextCacheBase *> caches = {};
+  return caches;
+}
+
+static std::mutex statisticsMutex = {};
+
+static ContextCacheBase::Statistics &getMutableStatistics() {
+  static ContextCacheBase::Statistics statistics = {};
+  return statistics;
+}
+
+ContextCacheBase::ContextCacheBase() { getCaches().push_back(this); }
+
+ContextCacheBase::~ContextCacheBase() {
+  auto &caches = getCaches();
+  caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+}
+
+const ContextCacheBase::Statistics &ContextCacheBase::getStatistics() {
+  return getMutableStatistics();
+}
+
+void ContextCacheBase::clearAll() {
+  for (ContextCacheBase *cache : getCaches()) {
+    cache->clear();
+  }
+}
+
+void ContextCacheBase::registerHit(Clock::duration creationTime) {
+  std::lock_guard lock{statisticsMutex};
+  getMutableStatistics().hits++;
+  getMutableStatistics().savedTime += creationTime;
+}
+
+void ContextCacheBase::registerMiss() {
+  std::lock_guard lock{statisticsMutex};
+  getMutableStatistics().misses++;
+}
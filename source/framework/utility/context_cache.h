@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Non-template part of ContextCache. It gathers statistics of all caches in
+// the process and allows releasing their objects before the backends are
+// unloaded.
+class ContextCacheBase {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Statistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    Clock::duration savedTime = {};
+  };
+
+  static const Statistics &getStatistics();
+  static void clearAll();
+
+protected:
+  ContextCacheBase();
+  virtual ~ContextCacheBase();
+  virtual void clear() = 0;
+
+  static void registerHit(Clock::duration creationTime);
+  static void registerMiss();
+};
+
+// Keeps backend objects, such as drivers, contexts and queues, alive between
+// test configurations, when enabled with --reuseContexts. A backend asks for
+// its objects with a key describing how they are set up and gives them back
+// instead of destroying them, so the next configuration with an equal key
+// gets them without paying the setup cost again. Creation and destruction are
+// callbacks, so the cache does not depend on any compute API.
+template <typename Key, typename Value>
+class ContextCache : public ContextCacheBase {
+public:
+  using CreateFunction = std::function<Value()>;
+  using DestroyFunction = std::function<void(Value &)>;
+
+  ContextCache(bool enabled, DestroyFunction destroy)
+      : enabled(enabled), destroy(std::move(destroy)) {}
+  ~ContextCache() override { clear(); }
+
+  bool isEnabled() const { return enabled; }
+
+  // Returns idle objects set up for the key or creates new ones. Cold requests
+  // always create new objects, for tests which require fresh backend state.
+  Value acquire(const Key &key, bool cold, const CreateFunction &create) {
+    if (!enabled) {
+      return create();
+    }
+
+    std::unique_lock lock{mutex};
+    if (auto it = idleValues.find(key); !cold && it != idleValues.end()) {
+      Value value = it->second.back();
+      it->second.pop_back();
+      if (it->second.empty()) {
+        idleValues.erase(it);
+      }
+      registerHit(creationTimes[key]);
+      return value;
+    }
+    lock.unlock();
+
+    const auto start = Clock::now();
+    Value value = create();
+    const auto creationTime = Clock::now() - start;
+
+    lock.lock();
+    creationTimes[key] = creationTime;
+    registerMiss();
+    return value;
+  }
+
+  // Gives objects back for reuse. They are destroyed if the cache is disabled.
+  void release(const Key &key, Value value) {
+    if (!enabled) {
+      destroy(value);
+      return;
+    }
+    std::lock_guard lock{mutex};
+    idleValues[key].push_back(value);
+  }
+
+  size_t getIdleCount() const {
+    std::lock_guard lock{mutex};
+    size_t result = 0;
+    for (const auto &[key, values] : idleValues) {
+      result += values.size();
+    }
+    return result;
+  }
+
+  void clear() override {
+    std::lock_guard lock{mutex};
+    for (auto &[key, values] : idleValues) {
+      for (Value &value : values) {
+        destroy(value);
+      }
+    }
+    idleValues.clear();
+  }
+
+private:
+  const bool enabled;
+  const DestroyFunction destroy;
+  std::map<Key, std::vector<Value>> idleValues = {};
+  std::map<Key, Clock::duration> creationTimes = {};
+  mutable std::mutex mutex = {};
+};
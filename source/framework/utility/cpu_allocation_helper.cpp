@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,7 @@
 #include <cstdint>
 
 CpuAllocationHelper::AlignedAllocation::AlignedAllocation(
-    std::unique_ptr<std::byte[]> &&rawMemory, std::byte *alignedMemory)
+    RawMemory &&rawMemory, std::byte *alignedMemory)
     : rawMemory(std::move(rawMemory)), alignedMemory(alignedMemory) {}
 
 CpuAllocationHelper::MisalignedAllocation::MisalignedAllocation(
@@ -20,9 +20,10 @@ CpuAllocationHelper::MisalignedAllocation::MisalignedAllocation(
 
 CpuAllocationHelper::AlignedAllocation
 CpuAllocationHelper::allocateAlignedAllocation(size_t size, size_t alignment) {
-  auto rawMemory = std::make_unique<std::byte[]>(size + alignment);
-  auto misalignment = reinterpret_cast<uintptr_t>(rawMemory.get()) % alignment;
-  auto alignedMemory = rawMemory.get() + alignment - misalignment;
+  // Extra space allows misaligning the allocation by up to alignment bytes
+  AlignedAllocation::RawMemory rawMemory{static_cast<std::byte *>(
+      HostAllocator::allocate(size + alignment, alignment))};
+  std::byte *alignedMemory = rawMemory.get();
   return AlignedAllocation(std::move(rawMemory), alignedMemory);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,19 +7,21 @@
 
 #pragma once
 
+#include "framework/utility/host_allocator.h"
+
 #include <cstddef>
 #include <memory>
 
 struct CpuAllocationHelper {
   class AlignedAllocation {
   public:
-    AlignedAllocation(std::unique_ptr<std::byte[]> &&rawMemory,
-                      std::byte *alignedMemory);
+    using RawMemory = std::unique_ptr<std::byte[], HostAllocator::Deleter>;
+    AlignedAllocation(RawMemory &&rawMemory, std::byte *alignedMemory);
     std::byte *get() { return alignedMemory; }
     operator std::byte *() { return alignedMemory; }
 
   private:
-    std::unique_ptr<std::byte[]> rawMemory;
+    RawMemory rawMemory;
     std::byte *alignedMemory;
   };
 
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cpu_placement.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/error.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+std::string CpuPlacementSlot::toString() const {
+  if (isEmpty()) {
+    return "";
+  }
+  std::string result = "cpus=" + CpuTopology::formatCpuList(cpus);
+  if (!numaNodes.empty()) {
+    result += " numa=" + CpuTopology::formatCpuList(numaNodes);
+  }
+  return result;
+}
+
+static CpuPlacementSlot createSlot(const CpuTopology &topology,
+                                   std::vector<size_t> cpus) {
+  CpuPlacementSlot slot{};
+  for (size_t cpu : cpus) {
+    slot.numaNodes.push_back(topology.getNumaNodeOfCpu(cpu));
+  }
+  std::sort(slot.numaNodes.begin(), slot.numaNodes.end());
+  const auto duplicates =
+      std::unique(slot.numaNodes.begin(), slot.numaNodes.end());
+  slot.numaNodes.erase(duplicates, slot.numaNodes.end());
+  slot.cpus = std::move(cpus);
+  return slot;
+}
+
+static std::vector<size_t> getCompactOrder(const CpuTopology &topology) {
+  // Neighbouring slots share a core first, then a package, then a NUMA node
+  std::vector<CpuTopology::LogicalCpu> cpus = topology.cpus;
+  std::sort(cpus.begin(), cpus.end(), [](const auto &a, const auto &b) {
+    return std::tie(a.numaNode, a.packageId, a.coreId, a.index) <
+           std::tie(b.numaNode, b.packageId, b.coreId, b.index);
+  });
+
+  std::vector<size_t> result = {};
+  for (const auto &cpu : cpus) {
+    result.push_back(cpu.index);
+  }
+  return result;
+}
+
+static std::vector<size_t> getScatterOrder(const CpuTopology &topology,
+                                           size_t numaNode) {
+  // Within a NUMA node, use every physical core before any SMT sibling
+  std::map<std::pair<size_t, size_t>, size_t> siblingsPerCore = {};
+  std::vector<std::pair<size_t, CpuTopology::LogicalCpu>> cpus = {};
+  for (const auto &cpu : topology.cpus) {
+    if (cpu.numaNode == numaNode) {
+      const size_t smtIndex = siblingsPerCore[{cpu.packageId, cpu.coreId}]++;
+      cpus.emplace_back(smtIndex, cpu);
+    }
+  }
+  std::sort(cpus.begin(), cpus.end(), [](const auto &a, const auto &b) {
+    return std::tie(a.first, a.second.packageId, a.second.coreId,
+                    a.second.index) < std::tie(b.first, b.second.packageId,
+                                               b.second.coreId, b.second.index);
+  });
+
+  std::vector<size_t> result = {};
+  for (const auto &cpu : cpus) {
+    result.push_back(cpu.second.index);
+  }
+  return result;
+}
+
+CpuPlacementSlot CpuPlacement::getSlot(size_t slotIndex) {
+  const Configuration &configuration = Configuration::get();
+  return getSlot(configuration.cpuPlacement, configuration.cpuList,
+                 CpuTopology::get(), slotIndex);
+}
+
+CpuPlacementSlot CpuPlacement::getSlot(CpuPlacementPolicy policy,
+                                       const std::string &cpuList,
+                                       const CpuTopology &topology,
+                                       size_t slotIndex) {
+  FATAL_ERROR_IF(topology.cpus.empty(), "No online CPUs were found");
+  const auto &numaNodes = topology.numaNodes;
+
+  switch (policy) {
+  case CpuPlacementPolicy::None:
+    return {};
+  case CpuPlacementPolicy::Compact: {
+    const std::vector<size_t> order = getCompactOrder(topology);
+    return createSlot(topology, {order[slotIndex % order.size()]});
+  }
+  case CpuPlacementPolicy::Scatter: {
+    const size_t numaNode = numaNodes[slotIndex % numaNodes.size()];
+    const std::vector<size_t> order = getScatterOrder(topology, numaNode);
+    FATAL_ERROR_IF(order.empty(), "NUMA node ", numaNode, " has no CPUs");
+    const size_t indexInNode = slotIndex / numaNodes.size();
+    return createSlot(topology, {order[indexInNode % order.size()]});
+  }
+  case CpuPlacementPolicy::NumaNode: {
+    const size_t numaNode = numaNodes[slotIndex % numaNodes.size()];
+    return createSlot(topology, topology.getCpusOfNumaNode(numaNode));
+  }
+  case CpuPlacementPolicy::Explicit: {
+    std::vector<std::string> slotLists = {};
+    std::istringstream cpuListStream{cpuList};
+    for (std::string slotList; std::getline(cpuListStream, slotList, ';');) {
+      slotLists.push_back(slotList);
+    }
+    FATAL_ERROR_IF(slotLists.empty(), "cpuList is empty");
+
+    std::vector<size_t> cpus = {};
+    const std::string &slotList = slotLists[slotIndex % slotLists.size()];
+    FATAL_ERROR_IF(!CpuTopology::parseCpuList(slotList, cpus),
+                   "Invalid cpuList entry \"", slotList, "\"");
+    return createSlot(topology, std::move(cpus));
+  }
+  default:
+    FATAL_ERROR("Unknown cpu placement policy");
+  }
+}
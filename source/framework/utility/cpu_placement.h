@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/cpu_placement_policy.h"
+#include "framework/utility/cpu_topology.h"
+
+#include <string>
+#include <vector>
+
+// Set of host CPUs and NUMA nodes assigned to a single benchmark thread or
+// child process. Empty slot means no placement is enforced.
+struct CpuPlacementSlot {
+  std::vector<size_t> cpus = {};
+  std::vector<size_t> numaNodes = {};
+
+  bool isEmpty() const { return cpus.empty(); }
+  std::string toString() const;
+};
+
+struct CpuPlacement {
+  // Returns placement for the slotIndex-th thread or process according to
+  // --cpuPlacement and --cpuList options
+  static CpuPlacementSlot getSlot(size_t slotIndex);
+  static CpuPlacementSlot getSlot(CpuPlacementPolicy policy,
+                                  const std::string &cpuList,
+                                  const CpuTopology &topology,
+                                  size_t slotIndex);
+
+  // OS-specific implementation
+  static void pinCurrentThread(const CpuPlacementSlot &slot);
+  static void bindMemory(void *address, size_t size,
+                         const CpuPlacementSlot &slot);
+};
+
+// Applies placement to the calling thread for its lifetime and restores the
+// previous one afterwards. On Linux, child processes created meanwhile
+// inherit it.
+class ScopedCpuPlacement {
+public:
+  explicit ScopedCpuPlacement(const CpuPlacementSlot &slot);
+  ~ScopedCpuPlacement() noexcept(false);
+
+  ScopedCpuPlacement(const ScopedCpuPlacement &) = delete;
+  ScopedCpuPlacement &operator=(const ScopedCpuPlacement &) = delete;
+
+private:
+  bool active = false;
+  std::vector<size_t> previousCpus = {};
+  int previousMemoryPolicy = 0;
+  std::vector<size_t> previousNumaNodes = {};
+};
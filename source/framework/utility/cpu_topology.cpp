@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cpu_topology.h"
+
+#include "framework/utility/error.h"
+
+#include <algorithm>
+#include <sstream>
+
+const CpuTopology &CpuTopology::get() {
+  static const CpuTopology topology = discover();
+  return topology;
+}
+
+std::vector<size_t> CpuTopology::getCpusOfNumaNode(size_t numaNode) const {
+  std::vector<size_t> result = {};
+  for (const LogicalCpu &cpu : cpus) {
+    if (cpu.numaNode == numaNode) {
+      result.push_back(cpu.index);
+    }
+  }
+  return result;
+}
+
+size_t CpuTopology::getNumaNodeOfCpu(size_t cpuIndex) const {
+  for (const LogicalCpu &cpu : cpus) {
+    if (cpu.index == cpuIndex) {
+      return cpu.numaNode;
+    }
+  }
+  FATAL_ERROR("CPU ", cpuIndex, " is not online");
+}
+
+bool CpuTopology::parseCpuList(const std::string &list,
+                               std::vector<size_t> &outCpus) {
+  outCpus.clear();
+  std::istringstream listStream{list};
+  for (std::string range; std::getline(listStream, range, ',');) {
+    range.erase(std::remove_if(range.begin(), range.end(), ::isspace),
+                range.end());
+    if (range.empty()) {
+      continue;
+    }
+    if (range.find_first_not_of("0123456789-") != std::string::npos) {
+      return false;
+    }
+
+    const size_t dashPosition = range.find('-');
+    const std::string firstString = range.substr(0, dashPosition);
+    const std::string lastString = dashPosition == std::string::npos
+                                       ? firstString
+                                       : range.substr(dashPosition + 1);
+    if (firstString.empty() || lastString.empty() ||
+        lastString.find('-') != std::string::npos) {
+      return false;
+    }
+
+    const size_t first = std::stoul(firstString);
+    const size_t last = std::stoul(lastString);
+    if (first > last) {
+      return false;
+    }
+    for (size_t cpu = first; cpu <= last; cpu++) {
+      outCpus.push_back(cpu);
+    }
+  }
+  return !outCpus.empty();
+}
+
+std::string CpuTopology::formatCpuList(std::vector<size_t> cpus) {
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  std::ostringstream result{};
+  for (size_t i = 0u; i < cpus.size();) {
+    size_t rangeEnd = i;
+    while (rangeEnd + 1 < cpus.size() &&
+           cpus[rangeEnd + 1] == cpus[rangeEnd] + 1) {
+      rangeEnd++;
+    }
+
+    if (i != 0) {
+      result << ',';
+    }
+    result << cpus[i];
+    if (rangeEnd != i) {
+      result << '-' << cpus[rangeEnd];
+    }
+    i = rangeEnd + 1;
+  }
+  return result.str();
+}
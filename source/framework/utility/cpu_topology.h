@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct CpuTopology {
+  struct LogicalCpu {
+    size_t index;
+    size_t coreId;
+    size_t packageId;
+    size_t numaNode;
+  };
+
+  std::vector<LogicalCpu> cpus = {};
+  std::vector<size_t> numaNodes = {};
+
+  static const CpuTopology &get();
+  std::vector<size_t> getCpusOfNumaNode(size_t numaNode) const;
+  size_t getNumaNodeOfCpu(size_t cpuIndex) const;
+
+  // Helpers for lists in sysfs format, e.g. "0-3,8,10-11"
+  static bool parseCpuList(const std::string &list,
+                           std::vector<size_t> &outCpus);
+  static std::string formatCpuList(std::vector<size_t> cpus);
+
+private:
+  static CpuTopology discover(); // OS-specific implementation
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,11 @@ std::vector<uint8_t> FileHelper::loadFile(const std::string &filePath,
 }
 
 std::vector<uint8_t> FileHelper::loadBinaryFile(const std::string &filePath) {
-  return loadFile(filePath, std::ios::in | std::ios::binary);
+  const MappedFile file{filePath};
+  if (!file.isValid()) {
+    return {};
+  }
+  return std::vector<uint8_t>(file.getData(), file.getData() + file.getSize());
 }
 
 std::vector<uint8_t> FileHelper::loadTextFile(const std::string &filePath) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <vector>
 
 struct FileHelper {
@@ -18,6 +19,24 @@ struct FileHelper {
   static std::vector<uint8_t> loadBinaryFile(const std::string &filePath);
   static std::vector<uint8_t> loadTextFile(const std::string &filePath);
 
+  // Read-only view of a whole file mapped into memory. It is invalid if the
+  // file cannot be opened or is empty.
+  class MappedFile {
+  public:
+    MappedFile(const std::string &filePath); // OS-specific implementation
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool isValid() const { return data != nullptr; }
+    const uint8_t *getData() const { return data; }
+    size_t getSize() const { return size; }
+
+  private:
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+  };
+
   class FileOrConsole {
   public:
     FileOrConsole(const std::string &filePath, std::ios::openmode openMode,
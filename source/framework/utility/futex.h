@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Blocking wait on a 32-bit word shared by threads of one process. A waiting
+// thread sleeps in the kernel until another thread wakes it, so unlike spinning
+// it does not occupy a core.
+struct Futex {
+  // OS-specific methods
+
+  // Returns after a wakeup or immediately if the word does not hold
+  // expectedValue. Spurious returns are possible, so callers have to check the
+  // word again.
+  static void wait(std::atomic<uint32_t> &word, uint32_t expectedValue);
+  static void wakeOne(std::atomic<uint32_t> &word);
+};
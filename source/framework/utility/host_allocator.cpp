@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "host_allocator.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/cpu_placement.h"
+#include "framework/utility/error.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+struct Registry {
+  std::mutex mutex;
+  std::unordered_map<void *, HostAllocator::Pages> allocations;
+  HostAllocationPolicy smallestPages = HostAllocationPolicy::Unknown;
+};
+
+// Static buffers may be freed after all other static objects are destroyed,
+// so the registry is never destroyed
+Registry &getRegistry() {
+  static Registry *registry = new Registry;
+  return *registry;
+}
+} // namespace
+
+void *HostAllocator::allocate(size_t size, size_t alignment,
+                              HostAllocationPolicy defaultPolicy) {
+  FATAL_ERROR_IF(alignment == 0 || (alignment & (alignment - 1)) != 0,
+                 "Host allocation alignment must be a power of two");
+
+  HostAllocationPolicy policy = defaultPolicy;
+  int64_t numaNode = -1;
+  if (Configuration::isLoaded()) {
+    const Configuration &configuration = Configuration::get();
+    if (configuration.hostAllocationPolicy != HostAllocationPolicy::Default) {
+      policy = configuration.hostAllocationPolicy;
+    }
+    numaNode = configuration.hostNumaNode;
+  }
+
+  const Pages pages = allocatePages(std::max<size_t>(size, 1), alignment,
+                                    policy);
+  if (numaNode >= 0) {
+    CpuPlacementSlot slot{};
+    slot.numaNodes.push_back(static_cast<size_t>(numaNode));
+    CpuPlacement::bindMemory(pages.buffer, size, slot);
+  }
+
+  Registry &registry = getRegistry();
+  std::lock_guard<std::mutex> lock{registry.mutex};
+  registry.allocations[pages.buffer] = pages;
+  if (registry.smallestPages == HostAllocationPolicy::Unknown ||
+      pages.policy < registry.smallestPages) {
+    registry.smallestPages = pages.policy;
+  }
+  return pages.buffer;
+}
+
+void HostAllocator::free(void *buffer) {
+  if (buffer == nullptr) {
+    return;
+  }
+
+  Pages pages{};
+  {
+    Registry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    const auto allocation = registry.allocations.find(buffer);
+    FATAL_ERROR_IF(allocation == registry.allocations.end(),
+                   "Freeing memory not allocated by HostAllocator");
+    pages = allocation->second;
+    registry.allocations.erase(allocation);
+  }
+  freePages(pages);
+}
+
+void HostAllocator::resetEffectivePageSize() {
+  Registry &registry = getRegistry();
+  std::lock_guard<std::mutex> lock{registry.mutex};
+  registry.smallestPages = HostAllocationPolicy::Unknown;
+}
+
+std::string HostAllocator::getEffectivePageSize() {
+  Registry &registry = getRegistry();
+  std::lock_guard<std::mutex> lock{registry.mutex};
+  switch (registry.smallestPages) {
+  case HostAllocationPolicy::SmallPages:
+    return "4K";
+  case HostAllocationPolicy::TransparentHugePages:
+    return "THP";
+  case HostAllocationPolicy::HugeTlb2M:
+    return "2M";
+  case HostAllocationPolicy::HugeTlb1G:
+    return "1G";
+  default:
+    return "";
+  }
+}
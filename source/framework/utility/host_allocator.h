@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/host_allocation_policy.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Host buffers of the framework. Their pages are selected according to
+// --hostAllocationPolicy and bound to --hostNumaNode, so that page walks and
+// TLB misses are the same for all host buffers and in every run. Memory
+// allocated by compute drivers, e.g. USM host allocations, is not affected.
+struct HostAllocator {
+  // Policy passed by the caller is used when --hostAllocationPolicy is
+  // Default. Returned memory is not touched.
+  static void *allocate(size_t size, size_t alignment = alignof(std::max_align_t),
+                        HostAllocationPolicy defaultPolicy =
+                            HostAllocationPolicy::Default);
+  static void free(void *buffer);
+
+  struct Deleter {
+    void operator()(void *buffer) const { HostAllocator::free(buffer); }
+  };
+  template <typename T>
+  static std::unique_ptr<T[], Deleter> allocateArray(size_t count) {
+    return std::unique_ptr<T[], Deleter>(
+        static_cast<T *>(allocate(count * sizeof(T), alignof(T))));
+  }
+
+  // Allows keeping std::vector contents in framework host buffers
+  template <typename T> struct StdAllocator {
+    using value_type = T;
+    StdAllocator() = default;
+    template <typename U> StdAllocator(const StdAllocator<U> &) {}
+    T *allocate(size_t count) {
+      return static_cast<T *>(
+          HostAllocator::allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *buffer, size_t) { HostAllocator::free(buffer); }
+    template <typename U> bool operator==(const StdAllocator<U> &) const {
+      return true;
+    }
+    template <typename U> bool operator!=(const StdAllocator<U> &) const {
+      return false;
+    }
+  };
+
+  // Smallest pages backing allocations made since the last reset. Empty
+  // string means no allocations were made or the policy is Default.
+  static void resetEffectivePageSize();
+  static std::string getEffectivePageSize();
+
+  // Memory backing a single buffer. Policy is the one actually applied, which
+  // may differ from the requested one after a fallback.
+  struct Pages {
+    void *base = nullptr;
+    size_t size = 0;
+    void *buffer = nullptr;
+    HostAllocationPolicy policy = HostAllocationPolicy::Unknown;
+  };
+
+private:
+  // OS-specific methods
+  static Pages allocatePages(size_t size, size_t alignment,
+                             HostAllocationPolicy policy);
+  static void freePages(const Pages &pages);
+};
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "host_cache.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/error.h"
+#include "framework/utility/memory_constants.h"
+#include "framework/utility/thread_team.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define HOST_CACHE_FLUSH_SUPPORTED
+#endif
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define TARGET_CLFLUSHOPT __attribute__((target("clflushopt")))
+#define TARGET_CLWB __attribute__((target("clwb")))
+#else
+#define TARGET_CLFLUSHOPT
+#define TARGET_CLWB
+#endif
+
+// Flushing a line takes long enough for smaller buffers to not be worth
+// waking up other threads
+constexpr static size_t parallelFlushThreshold =
+    64 * MemoryConstants::megaByte;
+
+static HostCacheState appliedState = HostCacheState::Unchanged;
+static volatile uint8_t touchSink = 0;
+
+#if defined(HOST_CACHE_FLUSH_SUPPORTED)
+static void flushLinesClflush(uint8_t *line, uint8_t *end, size_t lineSize) {
+  for (; line < end; line += lineSize) {
+    _mm_clflush(line);
+  }
+}
+
+TARGET_CLFLUSHOPT
+static void flushLinesClflushopt(uint8_t *line, uint8_t *end,
+                                 size_t lineSize) {
+  for (; line < end; line += lineSize) {
+    _mm_clflushopt(line);
+  }
+}
+
+TARGET_CLWB
+static void flushLinesClwb(uint8_t *line, uint8_t *end, size_t lineSize) {
+  for (; line < end; line += lineSize) {
+    _mm_clwb(line);
+  }
+}
+#endif
+
+void HostCache::prepare(const void *buffer, size_t size) {
+  prepare(buffer, size, Configuration::get().hostCacheState);
+}
+
+void HostCache::prepare(const void *buffer, size_t size,
+                        HostCacheState state) {
+  switch (state) {
+  case HostCacheState::Unchanged:
+    return;
+  case HostCacheState::Cold:
+    flush(buffer, size, getFastestFlushInstruction(),
+          size >= parallelFlushThreshold ? 0 : 1);
+    break;
+  case HostCacheState::LlcResident: {
+    // Lines of the buffer are pushed out of the private caches by reading a
+    // buffer twice as big as them. The buffer stays in the LLC only if both
+    // fit in it.
+    static const std::vector<uint8_t> evictionBuffer(
+        2 * std::max(getCacheSize(2), getCacheSize(1)) +
+            MemoryConstants::megaByte,
+        1);
+    touch(buffer, size);
+    touch(evictionBuffer.data(), evictionBuffer.size());
+    break;
+  }
+  case HostCacheState::L1Resident:
+    // Only the part of the buffer read last fits in L1, if it is bigger
+    touch(buffer, size);
+    break;
+  default:
+    FATAL_ERROR("Unknown host cache state");
+  }
+  appliedState = state;
+}
+
+void HostCache::flush(const void *buffer, size_t size,
+                      FlushInstruction instruction, size_t threadsCount) {
+  if (threadsCount == 1) {
+    flushLines(buffer, size, instruction, nullptr);
+    return;
+  }
+  ThreadTeam team{threadsCount};
+  flushLines(buffer, size, instruction, &team);
+}
+
+void HostCache::flush(const void *buffer, size_t size,
+                      FlushInstruction instruction, ThreadTeam &team) {
+  flushLines(buffer, size, instruction, &team);
+}
+
+void HostCache::flushLines(const void *buffer, size_t size,
+                           FlushInstruction instruction, ThreadTeam *team) {
+  if (size == 0) {
+    return;
+  }
+  FATAL_ERROR_IF(!isSupported(instruction), toString(instruction),
+                 " is not supported by the host");
+
+#if defined(HOST_CACHE_FLUSH_SUPPORTED)
+  const size_t lineSize = getCacheLineSize();
+  const uintptr_t address = reinterpret_cast<uintptr_t>(buffer);
+  uint8_t *first = reinterpret_cast<uint8_t *>(address / lineSize * lineSize);
+  const size_t linesCount =
+      (address + size - reinterpret_cast<uintptr_t>(first) + lineSize - 1) /
+      lineSize;
+  const auto flushLineRange = [&](size_t beginLine, size_t endLine) {
+    uint8_t *begin = first + beginLine * lineSize;
+    uint8_t *end = first + endLine * lineSize;
+    switch (instruction) {
+    case FlushInstruction::Clflush:
+      flushLinesClflush(begin, end, lineSize);
+      break;
+    case FlushInstruction::Clflushopt:
+      flushLinesClflushopt(begin, end, lineSize);
+      break;
+    case FlushInstruction::Clwb:
+      flushLinesClwb(begin, end, lineSize);
+      break;
+    }
+
+    // Weakly ordered flushes are complete only after a fence
+    _mm_mfence();
+  };
+
+  if (team == nullptr) {
+    flushLineRange(0, linesCount);
+    return;
+  }
+  team->run([&](size_t threadIndex, size_t teamSize) {
+    const size_t linesPerThread = (linesCount + teamSize - 1) / teamSize;
+    const size_t beginLine = std::min(threadIndex * linesPerThread, linesCount);
+    const size_t endLine = std::min(beginLine + linesPerThread, linesCount);
+    flushLineRange(beginLine, endLine);
+  });
+#else
+  (void)buffer;
+  (void)team;
+#endif
+}
+
+void HostCache::touch(const void *buffer, size_t size) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(buffer);
+  const size_t lineSize = getCacheLineSize();
+  uint8_t sum = 0;
+  for (size_t offset = 0; offset < size; offset += lineSize) {
+    sum += bytes[offset];
+  }
+  touchSink = sum;
+}
+
+bool HostCache::isSupported(FlushInstruction instruction) {
+#if defined(__GNUC__) && defined(__x86_64__)
+  switch (instruction) {
+  case FlushInstruction::Clflush:
+    return true;
+  case FlushInstruction::Clflushopt:
+    return __builtin_cpu_supports("clflushopt");
+  case FlushInstruction::Clwb:
+    return __builtin_cpu_supports("clwb");
+  }
+#elif defined(_MSC_VER) && defined(_M_X64)
+  int leaf7[4] = {};
+  __cpuidex(leaf7, 7, 0);
+  switch (instruction) {
+  case FlushInstruction::Clflush:
+    return true;
+  case FlushInstruction::Clflushopt:
+    return (leaf7[1] & (1 << 23)) != 0;
+  case FlushInstruction::Clwb:
+    return (leaf7[1] & (1 << 24)) != 0;
+  }
+#else
+  (void)instruction;
+#endif
+  return false;
+}
+
+HostCache::FlushInstruction HostCache::getFastestFlushInstruction() {
+  // Unlike clflush, flushes of different lines with clflushopt are not
+  // ordered with each other, so they can be in flight at the same time
+  if (isSupported(FlushInstruction::Clflushopt)) {
+    return FlushInstruction::Clflushopt;
+  }
+  return FlushInstruction::Clflush;
+}
+
+std::string HostCache::toString(FlushInstruction instruction) {
+  switch (instruction) {
+  case FlushInstruction::Clflush:
+    return "clflush";
+  case FlushInstruction::Clflushopt:
+    return "clflushopt";
+  case FlushInstruction::Clwb:
+    return "clwb";
+  default:
+    FATAL_ERROR("Unknown cache flush instruction");
+  }
+}
+
+size_t HostCache::getCacheLineSize() {
+  static const size_t lineSize = [] {
+    const size_t querySize = queryCacheLineSize();
+    return querySize != 0 ? querySize : size_t{64};
+  }();
+  return lineSize;
+}
+
+size_t HostCache::getCacheSize(size_t level) { return queryCacheSize(level); }
+
+size_t HostCache::getLastLevelCacheSize() {
+  for (size_t level = 4; level > 0; level--) {
+    if (const size_t size = getCacheSize(level); size != 0) {
+      return size;
+    }
+  }
+  return 0;
+}
+
+std::string HostCache::getCachesDescription() {
+  std::string description{};
+  for (size_t level = 1; level <= 4; level++) {
+    const size_t size = getCacheSize(level);
+    if (size == 0) {
+      continue;
+    }
+    if (!description.empty()) {
+      description += ", ";
+    }
+    description += "L" + std::to_string(level) + " ";
+    if (size % MemoryConstants::megaByte == 0) {
+      description += std::to_string(size / MemoryConstants::megaByte) + "MB";
+    } else {
+      description += std::to_string(size / MemoryConstants::kiloByte) + "KB";
+    }
+  }
+  return description;
+}
+
+void HostCache::resetAppliedState() {
+  appliedState = HostCacheState::Unchanged;
+}
+
+std::string HostCache::getAppliedState() {
+  switch (appliedState) {
+  case HostCacheState::Cold:
+    return "Cold";
+  case HostCacheState::LlcResident:
+    return "LLC";
+  case HostCacheState::L1Resident:
+    return "L1";
+  default:
+    return "";
+  }
+}
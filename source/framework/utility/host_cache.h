@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/host_cache_state.h"
+
+#include <cstddef>
+#include <string>
+
+class ThreadTeam;
+
+// Puts host buffers into a known cache state before measured iterations, so
+// results do not depend on what the previous iteration left in the caches
+struct HostCache {
+  enum class FlushInstruction {
+    Clflush,
+    Clflushopt,
+    Clwb, // writes dirty lines back, but leaves them in the cache
+  };
+
+  // Applies the state selected with --hostCacheState
+  static void prepare(const void *buffer, size_t size);
+  static void prepare(const void *buffer, size_t size, HostCacheState state);
+
+  // Zero threads means one per logical core. Lines are split between threads
+  // of the team, which can be reused by repeated flushes.
+  static void flush(const void *buffer, size_t size,
+                    FlushInstruction instruction, size_t threadsCount);
+  static void flush(const void *buffer, size_t size,
+                    FlushInstruction instruction, ThreadTeam &team);
+  static void touch(const void *buffer, size_t size);
+
+  static bool isSupported(FlushInstruction instruction);
+  static FlushInstruction getFastestFlushInstruction();
+  static std::string toString(FlushInstruction instruction);
+
+  // Sizes of data caches. Zero is returned for unknown levels.
+  static size_t getCacheLineSize();
+  static size_t getCacheSize(size_t level);
+  static size_t getLastLevelCacheSize();
+
+  // Data cache sizes of all levels, e.g. "L1 48KB, L2 2MB, L3 30MB". Empty if
+  // they cannot be queried.
+  static std::string getCachesDescription();
+
+  // State applied by prepare() since the last reset, empty if none
+  static void resetAppliedState();
+  static std::string getAppliedState();
+
+private:
+  static void flushLines(const void *buffer, size_t size,
+                         FlushInstruction instruction, ThreadTeam *team);
+
+  // OS-specific methods
+  static size_t queryCacheLineSize();
+  static size_t queryCacheSize(size_t level);
+};
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "host_copy.h"
+
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/error.h"
+#include "framework/utility/thread_team.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define HOST_COPY_X86
+#endif
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+constexpr static size_t cacheLineSize = 64;
+
+#if defined(HOST_COPY_X86)
+static void copyRepMovsb(void *dst, const void *src, size_t size) {
+#if defined(_MSC_VER)
+  __movsb(static_cast<unsigned char *>(dst),
+          static_cast<const unsigned char *>(src), size);
+#else
+  asm volatile("rep movsb"
+               : "+D"(dst), "+S"(src), "+c"(size)
+               :
+               : "memory");
+#endif
+}
+
+// Non-temporal stores have to be aligned, so the unaligned head of the
+// destination is copied with memcpy. Loads stay unaligned.
+static size_t copyHead(uint8_t *dst, const uint8_t *src, size_t size,
+                       size_t alignment) {
+  const size_t head = std::min(
+      alignUp(reinterpret_cast<uintptr_t>(dst), alignment) -
+          reinterpret_cast<uintptr_t>(dst),
+      size);
+  std::memcpy(dst, src, head);
+  return head;
+}
+
+template <bool nonTemporal>
+TARGET_AVX2
+static void copyAvx2(uint8_t *dst, const uint8_t *src, size_t size) {
+  constexpr size_t step = 4 * sizeof(__m256i);
+  size_t position = 0;
+  if constexpr (nonTemporal) {
+    position = copyHead(dst, src, size, sizeof(__m256i));
+  }
+  for (; position + step <= size; position += step) {
+    const __m256i *load = reinterpret_cast<const __m256i *>(src + position);
+    __m256i *store = reinterpret_cast<__m256i *>(dst + position);
+    const __m256i value0 = _mm256_loadu_si256(load + 0);
+    const __m256i value1 = _mm256_loadu_si256(load + 1);
+    const __m256i value2 = _mm256_loadu_si256(load + 2);
+    const __m256i value3 = _mm256_loadu_si256(load + 3);
+    if constexpr (nonTemporal) {
+      _mm256_stream_si256(store + 0, value0);
+      _mm256_stream_si256(store + 1, value1);
+      _mm256_stream_si256(store + 2, value2);
+      _mm256_stream_si256(store + 3, value3);
+    } else {
+      _mm256_storeu_si256(store + 0, value0);
+      _mm256_storeu_si256(store + 1, value1);
+      _mm256_storeu_si256(store + 2, value2);
+      _mm256_storeu_si256(store + 3, value3);
+    }
+  }
+  std::memcpy(dst + position, src + position, size - position);
+  if constexpr (nonTemporal) {
+    _mm_sfence();
+  }
+}
+
+template <bool nonTemporal>
+TARGET_AVX512
+static void copyAvx512(uint8_t *dst, const uint8_t *src, size_t size) {
+  constexpr size_t step = 4 * sizeof(__m512i);
+  size_t position = 0;
+  if constexpr (nonTemporal) {
+    position = copyHead(dst, src, size, sizeof(__m512i));
+  }
+  for (; position + step <= size; position += step) {
+    const __m512i *load = reinterpret_cast<const __m512i *>(src + position);
+    __m512i *store = reinterpret_cast<__m512i *>(dst + position);
+    const __m512i value0 = _mm512_loadu_si512(load + 0);
+    const __m512i value1 = _mm512_loadu_si512(load + 1);
+    const __m512i value2 = _mm512_loadu_si512(load + 2);
+    const __m512i value3 = _mm512_loadu_si512(load + 3);
+    if constexpr (nonTemporal) {
+      _mm512_stream_si512(store + 0, value0);
+      _mm512_stream_si512(store + 1, value1);
+      _mm512_stream_si512(store + 2, value2);
+      _mm512_stream_si512(store + 3, value3);
+    } else {
+      _mm512_storeu_si512(store + 0, value0);
+      _mm512_storeu_si512(store + 1, value1);
+      _mm512_storeu_si512(store + 2, value2);
+      _mm512_storeu_si512(store + 3, value3);
+    }
+  }
+  std::memcpy(dst + position, src + position, size - position);
+  if constexpr (nonTemporal) {
+    _mm_sfence();
+  }
+}
+#endif
+
+void HostCopy::copy(void *dst, const void *src, size_t size,
+                    HostCopyMethod method) {
+  FATAL_ERROR_IF(!isSupported(method), "Host copy method is not supported");
+#if defined(HOST_COPY_X86)
+  uint8_t *dstBytes = static_cast<uint8_t *>(dst);
+  const uint8_t *srcBytes = static_cast<const uint8_t *>(src);
+  switch (method) {
+  case HostCopyMethod::RepMovsb:
+    copyRepMovsb(dst, src, size);
+    return;
+  case HostCopyMethod::Avx2:
+    copyAvx2<false>(dstBytes, srcBytes, size);
+    return;
+  case HostCopyMethod::Avx2NonTemporal:
+    copyAvx2<true>(dstBytes, srcBytes, size);
+    return;
+  case HostCopyMethod::Avx512:
+    copyAvx512<false>(dstBytes, srcBytes, size);
+    return;
+  case HostCopyMethod::Avx512NonTemporal:
+    copyAvx512<true>(dstBytes, srcBytes, size);
+    return;
+  default:
+    break;
+  }
+#endif
+  std::memcpy(dst, src, size);
+}
+
+void HostCopy::copy(void *dst, const void *src, size_t size,
+                    HostCopyMethod method, ThreadTeam &team) {
+  if (team.getThreadsCount() == 1) {
+    copy(dst, src, size, method);
+    return;
+  }
+
+  team.run([&](size_t threadIndex, size_t threadsCount) {
+    const size_t partSize =
+        alignUp((size + threadsCount - 1) / threadsCount, cacheLineSize);
+    const size_t begin = std::min(threadIndex * partSize, size);
+    const size_t end = std::min(begin + partSize, size);
+    copy(static_cast<uint8_t *>(dst) + begin,
+         static_cast<const uint8_t *>(src) + begin, end - begin, method);
+  });
+}
+
+bool HostCopy::isSupported(HostCopyMethod method) {
+  switch (method) {
+  case HostCopyMethod::Memcpy:
+    return true;
+#if defined(__GNUC__) && defined(__x86_64__)
+  case HostCopyMethod::RepMovsb:
+    return true;
+  case HostCopyMethod::Avx2:
+  case HostCopyMethod::Avx2NonTemporal:
+    return __builtin_cpu_supports("avx2");
+  case HostCopyMethod::Avx512:
+  case HostCopyMethod::Avx512NonTemporal:
+    return __builtin_cpu_supports("avx512f");
+#elif defined(_MSC_VER) && defined(_M_X64)
+  case HostCopyMethod::RepMovsb:
+    return true;
+  case HostCopyMethod::Avx2:
+  case HostCopyMethod::Avx2NonTemporal:
+  case HostCopyMethod::Avx512:
+  case HostCopyMethod::Avx512NonTemporal: {
+    // Besides the CPU, the OS has to save the wider registers
+    int leaf1[4] = {};
+    int leaf7[4] = {};
+    __cpuid(leaf1, 1);
+    __cpuidex(leaf7, 7, 0);
+    if ((leaf1[2] & (1 << 27)) == 0) {
+      return false;
+    }
+    const unsigned long long enabledStates = _xgetbv(0);
+    if (method == HostCopyMethod::Avx2 ||
+        method == HostCopyMethod::Avx2NonTemporal) {
+      return (leaf7[1] & (1 << 5)) != 0 && (enabledStates & 0x6) == 0x6;
+    }
+    return (leaf7[1] & (1 << 16)) != 0 && (enabledStates & 0xe6) == 0xe6;
+  }
+#endif
+  default:
+    return false;
+  }
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/enum/host_copy_method.h"
+
+#include <cstddef>
+
+class ThreadTeam;
+
+// Copies between host buffers with a selected instruction sequence. Methods
+// are compared by HostMemcpy, so host staging paths can use the fastest one
+// for a given size.
+struct HostCopy {
+  static void copy(void *dst, const void *src, size_t size,
+                   HostCopyMethod method);
+
+  // Buffers are split into cache line aligned parts, one per thread of the
+  // team. Single-thread teams copy on the calling thread without waking up.
+  static void copy(void *dst, const void *src, size_t size,
+                   HostCopyMethod method, ThreadTeam &team);
+
+  static bool isSupported(HostCopyMethod method);
+};
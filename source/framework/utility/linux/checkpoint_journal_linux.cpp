@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/checkpoint_journal.h"
+#include "framework/utility/error.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+void CheckpointJournal::openFile() {
+  const int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
+  const int fd = open(filePath.c_str(), flags, 0644);
+  FATAL_ERROR_IF(fd < 0, "Cannot open journal file \"", filePath, "\"");
+  fileHandle = fd;
+}
+
+void CheckpointJournal::writeToFile(const std::string &data) {
+  const int fd = static_cast<int>(fileHandle);
+  const ssize_t written = write(fd, data.c_str(), data.size());
+  FATAL_ERROR_IF(written != static_cast<ssize_t>(data.size()),
+                 "Cannot write to journal file \"", filePath, "\"");
+  fdatasync(fd);
+}
+
+void CheckpointJournal::closeFile() {
+  close(static_cast<int>(fileHandle));
+  fileHandle = -1;
+}
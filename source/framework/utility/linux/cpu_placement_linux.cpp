@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_placement.h"
+#include "framework/utility/error.h"
+#include "framework/utility/linux/error.h"
+
+#include <array>
+#include <climits>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// NUMA syscalls are called directly to avoid depending on libnuma
+constexpr size_t maxNumaNodes = 1024;
+constexpr size_t bitsPerMaskWord = sizeof(unsigned long) * CHAR_BIT;
+using NumaNodeMask = std::array<unsigned long, maxNumaNodes / bitsPerMaskWord>;
+
+static NumaNodeMask createNumaNodeMask(const std::vector<size_t> &numaNodes) {
+  NumaNodeMask mask{};
+  for (size_t numaNode : numaNodes) {
+    FATAL_ERROR_IF(numaNode >= maxNumaNodes, "Too high NUMA node index");
+    mask[numaNode / bitsPerMaskWord] |= 1ul << (numaNode % bitsPerMaskWord);
+  }
+  return mask;
+}
+
+static std::vector<size_t> getNumaNodesFromMask(const NumaNodeMask &mask) {
+  std::vector<size_t> result = {};
+  for (size_t numaNode = 0u; numaNode < maxNumaNodes; numaNode++) {
+    if (mask[numaNode / bitsPerMaskWord] &
+        (1ul << (numaNode % bitsPerMaskWord))) {
+      result.push_back(numaNode);
+    }
+  }
+  return result;
+}
+
+static void setMemoryPolicy(int mode, const std::vector<size_t> &numaNodes) {
+  // Kernel treats maxnode as bit count + 1
+  const NumaNodeMask mask = createNumaNodeMask(numaNodes);
+  const bool hasMask = mode != MPOL_DEFAULT;
+  const long result =
+      syscall(SYS_set_mempolicy, mode, hasMask ? mask.data() : nullptr,
+              hasMask ? maxNumaNodes + 1 : 0);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(result, "set_mempolicy failed");
+}
+
+static void setThreadAffinity(const std::vector<size_t> &cpus) {
+  cpu_set_t cpuSet{};
+  CPU_ZERO(&cpuSet);
+  for (size_t cpu : cpus) {
+    FATAL_ERROR_IF(cpu >= CPU_SETSIZE, "Too high CPU index");
+    CPU_SET(cpu, &cpuSet);
+  }
+  FATAL_ERROR_IF_SYS_CALL_FAILED(sched_setaffinity(0, sizeof(cpuSet), &cpuSet),
+                                 "sched_setaffinity failed");
+}
+
+void CpuPlacement::pinCurrentThread(const CpuPlacementSlot &slot) {
+  if (slot.isEmpty()) {
+    return;
+  }
+
+  setThreadAffinity(slot.cpus);
+  if (!slot.numaNodes.empty()) {
+    setMemoryPolicy(MPOL_BIND, slot.numaNodes);
+  }
+}
+
+void CpuPlacement::bindMemory(void *address, size_t size,
+                              const CpuPlacementSlot &slot) {
+  if (slot.numaNodes.empty() || size == 0) {
+    return;
+  }
+
+  // mbind operates on whole pages
+  const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = reinterpret_cast<uintptr_t>(address) & ~(pageSize - 1);
+  const auto end = reinterpret_cast<uintptr_t>(address) + size;
+
+  const NumaNodeMask mask = createNumaNodeMask(slot.numaNodes);
+  const long result =
+      syscall(SYS_mbind, begin, end - begin, MPOL_BIND, mask.data(),
+              maxNumaNodes + 1, MPOL_MF_MOVE);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(result, "mbind failed");
+}
+
+ScopedCpuPlacement::ScopedCpuPlacement(const CpuPlacementSlot &slot) {
+  if (slot.isEmpty()) {
+    return;
+  }
+
+  cpu_set_t cpuSet{};
+  FATAL_ERROR_IF_SYS_CALL_FAILED(sched_getaffinity(0, sizeof(cpuSet), &cpuSet),
+                                 "sched_getaffinity failed");
+  for (size_t cpu = 0u; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &cpuSet)) {
+      previousCpus.push_back(cpu);
+    }
+  }
+
+  NumaNodeMask mask{};
+  const long result = syscall(SYS_get_mempolicy, &previousMemoryPolicy,
+                              mask.data(), maxNumaNodes, nullptr, 0);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(result, "get_mempolicy failed");
+  previousNumaNodes = getNumaNodesFromMask(mask);
+
+  CpuPlacement::pinCurrentThread(slot);
+  active = true;
+}
+
+ScopedCpuPlacement::~ScopedCpuPlacement() noexcept(false) {
+  if (!active) {
+    return;
+  }
+
+  setThreadAffinity(previousCpus);
+  setMemoryPolicy(previousMemoryPolicy, previousNumaNodes);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_topology.h"
+#include "framework/utility/working_directory_helper.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <thread>
+
+static std::string readSysfsLine(const std::string &path) {
+  std::ifstream file{path};
+  std::string line{};
+  std::getline(file, line);
+  return line;
+}
+
+static size_t readSysfsNumber(const std::string &path, size_t defaultValue) {
+  const std::string line = readSysfsLine(path);
+  if (line.empty() ||
+      line.find_first_not_of("0123456789") != std::string::npos) {
+    return defaultValue;
+  }
+  return std::stoul(line);
+}
+
+CpuTopology CpuTopology::discover() {
+  CpuTopology topology{};
+
+  std::vector<size_t> onlineCpus = {};
+  if (!parseCpuList(readSysfsLine("/sys/devices/system/cpu/online"),
+                    onlineCpus)) {
+    for (size_t cpu = 0u; cpu < std::thread::hardware_concurrency(); cpu++) {
+      onlineCpus.push_back(cpu);
+    }
+  }
+
+  // Kernels without NUMA support do not expose any nodes. Everything is then
+  // treated as a single node 0.
+  std::map<size_t, size_t> cpuToNumaNode = {};
+  const FileSystem::path nodesPath = "/sys/devices/system/node";
+  std::error_code errorCode{};
+  for (const auto &entry :
+       FileSystem::directory_iterator(nodesPath, errorCode)) {
+    const std::string name = entry.path().filename().string();
+    const std::string prefix = "node";
+    if (name.size() <= prefix.size() ||
+        name.compare(0, prefix.size(), prefix) != 0 ||
+        name.find_first_not_of("0123456789", prefix.size()) !=
+            std::string::npos) {
+      continue;
+    }
+
+    const size_t numaNode = std::stoul(name.substr(prefix.size()));
+    std::vector<size_t> nodeCpus = {};
+    if (!parseCpuList(readSysfsLine((entry.path() / "cpulist").string()),
+                      nodeCpus)) {
+      continue; // memory-only node
+    }
+    for (size_t cpu : nodeCpus) {
+      cpuToNumaNode[cpu] = numaNode;
+    }
+    topology.numaNodes.push_back(numaNode);
+  }
+  if (topology.numaNodes.empty()) {
+    topology.numaNodes.push_back(0);
+  }
+  std::sort(topology.numaNodes.begin(), topology.numaNodes.end());
+
+  for (size_t cpu : onlineCpus) {
+    const std::string cpuPath =
+        "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+    LogicalCpu logicalCpu{};
+    logicalCpu.index = cpu;
+    logicalCpu.coreId = readSysfsNumber(cpuPath + "core_id", cpu);
+    logicalCpu.packageId = readSysfsNumber(cpuPath + "physical_package_id", 0);
+    const auto numaNode = cpuToNumaNode.find(cpu);
+    logicalCpu.numaNode = numaNode != cpuToNumaNode.end()
+                              ? numaNode->second
+                              : topology.numaNodes.front();
+    topology.cpus.push_back(logicalCpu);
+  }
+
+  return topology;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/file_helper.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FileHelper::MappedFile::MappedFile(const std::string &filePath) {
+  const int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return;
+  }
+
+  // The mapping stays valid after closing the descriptor
+  struct stat fileStatus = {};
+  if (fstat(fd, &fileStatus) == 0 && fileStatus.st_size > 0) {
+    const size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+    void *mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      this->data = static_cast<const uint8_t *>(mapping);
+      this->size = fileSize;
+    }
+  }
+  close(fd);
+}
+
+FileHelper::MappedFile::~MappedFile() {
+  if (data != nullptr) {
+    munmap(const_cast<uint8_t *>(data), size);
+  }
+}
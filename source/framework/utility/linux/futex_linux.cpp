@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/futex.h"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex word has to be a plain 32-bit integer");
+
+void Futex::wait(std::atomic<uint32_t> &word, uint32_t expectedValue) {
+  // EAGAIN and EINTR are both spurious returns for the caller
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE,
+          expectedValue, nullptr, nullptr, 0);
+}
+
+void Futex::wakeOne(std::atomic<uint32_t> &word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE,
+          1, nullptr, nullptr, 0);
+}
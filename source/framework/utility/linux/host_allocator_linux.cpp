@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/error.h"
+#include "framework/utility/host_allocator.h"
+#include "framework/utility/linux/error.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <linux/mman.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static void *mapAnonymous(size_t size, int flags) {
+  void *address = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  return address == MAP_FAILED ? nullptr : address;
+}
+
+static void warnAboutHugeTlbFallback() {
+  static bool warned = false;
+  if (!warned) {
+    printMessageLine("WARNING", "Could not map hugetlbfs pages, transparent "
+                                "huge pages are used instead. Reserve pages "
+                                "in /sys/kernel/mm/hugepages");
+    warned = true;
+  }
+}
+
+HostAllocator::Pages HostAllocator::allocatePages(size_t size,
+                                                  size_t alignment,
+                                                  HostAllocationPolicy policy) {
+  Pages pages{};
+  pages.policy = policy;
+
+  if (policy == HostAllocationPolicy::Default) {
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    pages.size = alignUp(size, alignment);
+    pages.base = std::aligned_alloc(alignment, pages.size);
+    FATAL_ERROR_IF(pages.base == nullptr, "Host allocation failed");
+    pages.buffer = pages.base;
+    return pages;
+  }
+
+  // Mappings are aligned to their pages. Larger alignment is achieved by
+  // mapping more and using an aligned part of the mapping.
+  size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  int flags = 0;
+  switch (policy) {
+  case HostAllocationPolicy::HugeTlb2M:
+    pageSize = 2 * 1024 * 1024;
+    flags = MAP_HUGETLB | MAP_HUGE_2MB;
+    break;
+  case HostAllocationPolicy::HugeTlb1G:
+    pageSize = 1024 * 1024 * 1024;
+    flags = MAP_HUGETLB | MAP_HUGE_1GB;
+    break;
+  case HostAllocationPolicy::TransparentHugePages:
+    alignment = std::max<size_t>(alignment, sizeOf2MB);
+    break;
+  default:
+    break;
+  }
+  const size_t padding = alignment > pageSize ? alignment : 0;
+  pages.size = alignUp(size, pageSize) + padding;
+  pages.base = mapAnonymous(pages.size, flags);
+
+  if (pages.base == nullptr && flags != 0) {
+    warnAboutHugeTlbFallback();
+    return allocatePages(size, alignment,
+                         HostAllocationPolicy::TransparentHugePages);
+  }
+  FATAL_ERROR_IF(pages.base == nullptr, "Host allocation failed, ",
+                 getErrorFromErrno());
+  pages.buffer = reinterpret_cast<void *>(
+      alignUp(reinterpret_cast<uintptr_t>(pages.base), alignment));
+
+  if (policy == HostAllocationPolicy::TransparentHugePages) {
+    madvise(pages.base, pages.size, MADV_HUGEPAGE);
+  } else if (policy == HostAllocationPolicy::SmallPages) {
+    madvise(pages.base, pages.size, MADV_NOHUGEPAGE);
+  }
+  return pages;
+}
+
+void HostAllocator::freePages(const Pages &pages) {
+  if (pages.policy == HostAllocationPolicy::Default) {
+    std::free(pages.base);
+    return;
+  }
+  FATAL_ERROR_IF_SYS_CALL_FAILED(munmap(pages.base, pages.size),
+                                 "munmap failed");
+}
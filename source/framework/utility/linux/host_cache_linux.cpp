@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/host_cache.h"
+
+#include <fstream>
+#include <string>
+
+// Caches of the first CPU are described in sysfs, one directory per cache
+static std::string readCacheAttribute(size_t index, const char *attribute) {
+  std::ifstream file{"/sys/devices/system/cpu/cpu0/cache/index" +
+                     std::to_string(index) + "/" + attribute};
+  std::string value{};
+  file >> value;
+  return value;
+}
+
+static size_t parseCacheSize(const std::string &value) {
+  size_t suffixPosition = 0;
+  size_t size = 0;
+  try {
+    size = std::stoull(value, &suffixPosition);
+  } catch (...) {
+    return 0;
+  }
+  const std::string suffix = value.substr(suffixPosition);
+  if (suffix == "K") {
+    return size * 1024;
+  }
+  if (suffix == "M") {
+    return size * 1024 * 1024;
+  }
+  return size;
+}
+
+size_t HostCache::queryCacheLineSize() {
+  return parseCacheSize(readCacheAttribute(0, "coherency_line_size"));
+}
+
+size_t HostCache::queryCacheSize(size_t level) {
+  for (size_t index = 0;; index++) {
+    const std::string cacheLevel = readCacheAttribute(index, "level");
+    if (cacheLevel.empty()) {
+      return 0;
+    }
+    const std::string type = readCacheAttribute(index, "type");
+    if (cacheLevel == std::to_string(level) && type != "Instruction") {
+      return parseCacheSize(readCacheAttribute(index, "size"));
+    }
+  }
+}
@@ -9,12 +9,9 @@
 
 #include "framework/utility/linux/error.h"
 
+#include <cstring>
 #include <memory>
 
-#ifdef USE_PIDFD
-#include <sys/syscall.h>
-#endif // USE_PIDFD
-
 TestResult socketCreate(int &socketNew) {
   socketNew = socket(AF_UNIX, SOCK_STREAM, 0);
   if (socketNew <= 0) {
@@ -120,9 +117,11 @@ TestResult socketConnect(const int socketLocal, const std::string &socketName) {
   return TestResult::Success;
 }
 
-TestResult socketSendDataWithFd(const int socketReceiver, const int fd,
-                                void *data, const ssize_t nBytes) {
-  std::unique_ptr<uint8_t[]> controlMessage(new uint8_t[CMSG_SPACE(nBytes)]());
+TestResult socketSendDataWithFds(const int socketReceiver,
+                                 const std::vector<int> &fds, void *data,
+                                 const ssize_t nBytes) {
+  const size_t fdsSize = fds.size() * sizeof(int);
+  std::unique_ptr<uint8_t[]> controlMessage(new uint8_t[CMSG_SPACE(fdsSize)]());
 
   iovec message{};
   message.iov_base = data;
@@ -131,17 +130,19 @@ TestResult socketSendDataWithFd(const int socketReceiver, const int fd,
   msghdr messageHeader{};
   messageHeader.msg_iov = &message;
   messageHeader.msg_iovlen = 1;
-  messageHeader.msg_control = controlMessage.get();
-  messageHeader.msg_controllen = CMSG_LEN(sizeof(int));
+  if (!fds.empty()) {
+    messageHeader.msg_control = controlMessage.get();
+    messageHeader.msg_controllen = CMSG_SPACE(fdsSize);
 
-  cmsghdr *controlMessageHeaderPtr = CMSG_FIRSTHDR(&messageHeader);
-  if (nullptr == controlMessageHeaderPtr) {
-    return TestResult::Error;
+    cmsghdr *controlMessageHeaderPtr = CMSG_FIRSTHDR(&messageHeader);
+    if (nullptr == controlMessageHeaderPtr) {
+      return TestResult::Error;
+    }
+    controlMessageHeaderPtr->cmsg_type = SCM_RIGHTS;
+    controlMessageHeaderPtr->cmsg_level = SOL_SOCKET;
+    controlMessageHeaderPtr->cmsg_len = CMSG_LEN(fdsSize);
+    std::memcpy(CMSG_DATA(controlMessageHeaderPtr), fds.data(), fdsSize);
   }
-  controlMessageHeaderPtr->cmsg_type = SCM_RIGHTS;
-  controlMessageHeaderPtr->cmsg_level = SOL_SOCKET;
-  controlMessageHeaderPtr->cmsg_len = CMSG_LEN(sizeof(int));
-  *reinterpret_cast<int *>(CMSG_DATA(controlMessageHeaderPtr)) = fd;
 
   if (nBytes != sendmsg(socketReceiver, &messageHeader, 0)) {
     return TestResult::Error;
@@ -150,9 +151,10 @@ TestResult socketSendDataWithFd(const int socketReceiver, const int fd,
   return TestResult::Success;
 }
 
-TestResult socketRecvDataWithFd(const int socketSender, int &fd, void *data,
-                                const ssize_t nBytes) {
-  std::unique_ptr<uint8_t[]> controlMessage(new uint8_t[CMSG_SPACE(nBytes)]());
+TestResult socketRecvDataWithFds(const int socketSender, std::vector<int> &fds,
+                                 void *data, const ssize_t nBytes) {
+  const size_t fdsSize = fds.size() * sizeof(int);
+  std::unique_ptr<uint8_t[]> controlMessage(new uint8_t[CMSG_SPACE(fdsSize)]());
 
   iovec message{};
   message.iov_base = data;
@@ -162,54 +164,22 @@ TestResult socketRecvDataWithFd(const int socketSender, int &fd, void *data,
   messageHeader.msg_iov = &message;
   messageHeader.msg_iovlen = 1;
   messageHeader.msg_control = controlMessage.get();
-  messageHeader.msg_controllen = CMSG_LEN(sizeof(int));
+  messageHeader.msg_controllen = CMSG_SPACE(fdsSize);
 
-  if (nBytes != recvmsg(socketSender, &messageHeader, 0)) {
+  if (nBytes != recvmsg(socketSender, &messageHeader, MSG_WAITALL)) {
     return TestResult::Error;
   }
-
-  cmsghdr *controlMessageHeaderPtr = CMSG_FIRSTHDR(&messageHeader);
-  if (nullptr == controlMessageHeaderPtr) {
-    return TestResult::Error;
-  }
-  fd = *reinterpret_cast<int *>(CMSG_DATA(controlMessageHeaderPtr));
-  if (fd <= 0) {
-    return TestResult::Error;
+  if (fds.empty()) {
+    return TestResult::Success;
   }
 
-  return TestResult::Success;
-}
-
-#ifdef USE_PIDFD
-
-std::string serializeBinaryToStr(void *data, const size_t nBytes) {
-  std::stringstream stream;
-  stream << std::hex << std::setfill('0');
-  for (size_t i = 0; i < nBytes; i++) {
-    stream << std::setw(2) << static_cast<int>(static_cast<uint8_t *>(data)[i]);
-  }
-  return stream.str();
-}
-
-void deserializeStrToBinary(void *data, const std::string str) {
-  for (size_t i = 0; i < str.length() / 2; i++) {
-    reinterpret_cast<uint8_t *>(data)[i] =
-        std::stoi(str.substr(2 * i, 2), nullptr, 16);
-  }
-}
-
-TestResult translateParentFd(const pid_t parentPid, const int parentFd,
-                             int &fd) {
-  const int parentPidFd = syscall(SYS_pidfd_open, parentPid, 0);
-  if (parentPidFd <= 0) {
-    return TestResult::Error;
-  }
-  fd = syscall(SYS_pidfd_getfd, parentPidFd, parentFd, 0);
-  if (fd <= 0) {
+  cmsghdr *controlMessageHeaderPtr = CMSG_FIRSTHDR(&messageHeader);
+  if (nullptr == controlMessageHeaderPtr ||
+      controlMessageHeaderPtr->cmsg_len != CMSG_LEN(fdsSize) ||
+      (messageHeader.msg_flags & MSG_CTRUNC) != 0) {
     return TestResult::Error;
   }
+  std::memcpy(fds.data(), CMSG_DATA(controlMessageHeaderPtr), fdsSize);
 
   return TestResult::Success;
 }
-
-#endif // USE_PIDFD
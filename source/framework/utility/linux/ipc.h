@@ -23,19 +23,11 @@ TestResult socketAccept(const int socketListening,
 
 TestResult socketConnect(const int socketLocal, const std::string &socketName);
 
-TestResult socketSendDataWithFd(const int socketReceiver, const int fd,
-                                void *data, const ssize_t nBytes);
-
-TestResult socketRecvDataWithFd(const int socketSender, int &fd, void *data,
-                                const ssize_t nBytes);
-
-#ifdef USE_PIDFD
-
-std::string serializeBinaryToStr(void *data, const size_t len);
-
-void deserializeStrToBinary(void *data, const std::string str);
-
-TestResult translateParentFd(const pid_t parentPid, const int parentFd,
-                             int &fd);
-
-#endif // USE_PIDFD
+// All descriptors are transferred in a single SCM_RIGHTS message. Receiver has
+// to size fds to the number of expected descriptors.
+TestResult socketSendDataWithFds(const int socketReceiver,
+                                 const std::vector<int> &fds, void *data,
+                                 const ssize_t nBytes);
+
+TestResult socketRecvDataWithFds(const int socketSender, std::vector<int> &fds,
+                                 void *data, const ssize_t nBytes);
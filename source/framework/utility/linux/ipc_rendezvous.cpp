@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/linux/ipc_rendezvous.h"
+
+#include "framework/utility/error.h"
+#include "framework/utility/linux/error.h"
+#include "framework/utility/linux/ipc.h"
+#include "framework/utility/timer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+struct alignas(8) IpcRendezvous::Directory {
+  uint32_t participantsCount;
+  uint32_t slotsCount;
+  pid_t creatorPid;
+  std::atomic<uint32_t> barrierArrived;
+  std::atomic<uint32_t> barrierGeneration;
+};
+
+struct alignas(8) IpcRendezvous::Participant {
+  std::atomic<uint64_t> exchangeTimeNs;
+  std::atomic<uint32_t> requestsCount;
+};
+
+struct alignas(8) IpcRendezvous::Slot {
+  uint32_t size;
+  uint32_t hasFd;
+  uint8_t data[maxSlotSize];
+};
+
+// Participants wait for each other only during setup, so a peer which does not
+// show up within this time most likely died
+constexpr static std::chrono::seconds barrierTimeout{60};
+
+size_t IpcRendezvous::getDirectorySize(uint32_t participantsCount,
+                                       uint32_t slotsCount) {
+  return sizeof(Directory) + participantsCount * sizeof(Participant) +
+         participantsCount * slotsCount * sizeof(Slot);
+}
+
+IpcRendezvous::IpcRendezvous(uint32_t participantsCount, uint32_t slotsCount) {
+  FATAL_ERROR_IF(participantsCount == 0, "IPC rendezvous needs participants");
+  FATAL_ERROR_IF(slotsCount == 0 || slotsCount > maxSlotsCount,
+                 "Invalid number of IPC rendezvous slots: ", slotsCount);
+
+  this->directoryFd = memfd_create("ipc_rendezvous", MFD_CLOEXEC);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(this->directoryFd, "memfd_create failed");
+  const size_t size = getDirectorySize(participantsCount, slotsCount);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(ftruncate(this->directoryFd, size),
+                                 "ftruncate failed");
+  mapDirectory(size);
+
+  // Memory of a new memfd is zeroed, only non-zero fields are set
+  new (directory) Directory{participantsCount, slotsCount, getpid(), {0}, {0}};
+  for (auto participantRank = 0u; participantRank < participantsCount;
+       participantRank++) {
+    new (&getParticipant(participantRank)) Participant{{0}, {0}};
+  }
+}
+
+IpcRendezvous::IpcRendezvous(int directoryFd) {
+  this->directoryFd = directoryFd;
+  struct stat fileStatus = {};
+  FATAL_ERROR_IF_SYS_CALL_FAILED(fstat(directoryFd, &fileStatus),
+                                 "fstat failed");
+  const auto size = static_cast<size_t>(fileStatus.st_size);
+  FATAL_ERROR_IF(size < sizeof(Directory), "Invalid IPC rendezvous directory");
+  mapDirectory(size);
+  FATAL_ERROR_IF(size != getDirectorySize(getParticipantsCount(),
+                                          getSlotsCount()),
+                 "Invalid IPC rendezvous directory");
+}
+
+IpcRendezvous::~IpcRendezvous() noexcept(false) {
+  closeReceivedFds();
+  FATAL_ERROR_IF_SYS_CALL_FAILED(munmap(directory, directorySize),
+                                 "munmap failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(directoryFd), "closing memfd failed");
+}
+
+void IpcRendezvous::mapDirectory(size_t size) {
+  void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      this->directoryFd, 0);
+  FATAL_ERROR_IF(memory == MAP_FAILED, "mmap failed, ", getErrorFromErrno());
+  this->directory = static_cast<Directory *>(memory);
+  this->directorySize = size;
+}
+
+uint32_t IpcRendezvous::getParticipantsCount() const {
+  return directory->participantsCount;
+}
+
+uint32_t IpcRendezvous::getSlotsCount() const { return directory->slotsCount; }
+
+IpcRendezvous::Participant &
+IpcRendezvous::getParticipant(uint32_t participantRank) const {
+  FATAL_ERROR_IF(participantRank >= getParticipantsCount(),
+                 "Invalid IPC rendezvous rank: ", participantRank);
+  auto participants = reinterpret_cast<Participant *>(directory + 1);
+  return participants[participantRank];
+}
+
+IpcRendezvous::Slot &IpcRendezvous::getSlot(uint32_t participantRank,
+                                            uint32_t slot) const {
+  FATAL_ERROR_IF(participantRank >= getParticipantsCount(),
+                 "Invalid IPC rendezvous rank: ", participantRank);
+  FATAL_ERROR_IF(slot >= getSlotsCount(), "Invalid IPC rendezvous slot: ",
+                 slot);
+  auto slots = reinterpret_cast<Slot *>(
+      reinterpret_cast<Participant *>(directory + 1) + getParticipantsCount());
+  return slots[participantRank * getSlotsCount() + slot];
+}
+
+void IpcRendezvous::setRank(uint32_t newRank) {
+  FATAL_ERROR_IF(newRank >= getParticipantsCount(),
+                 "Invalid IPC rendezvous rank: ", newRank);
+  this->rank = newRank;
+  this->hasRank = true;
+  this->publishedFds.assign(getSlotsCount(), -1);
+  this->receivedFds.assign(getParticipantsCount() * getSlotsCount(), -1);
+  this->receivedData.assign(
+      getParticipantsCount() * getSlotsCount() * maxSlotSize, 0);
+}
+
+void IpcRendezvous::publish(uint32_t slot, const void *data, size_t size,
+                            int fd) {
+  FATAL_ERROR_IF(!hasRank, "IPC rendezvous rank was not set");
+  FATAL_ERROR_IF(size > maxSlotSize, "IPC rendezvous slot data too big");
+  Slot &slotData = getSlot(rank, slot);
+  std::memcpy(slotData.data, data, size);
+  slotData.size = static_cast<uint32_t>(size);
+  slotData.hasFd = fd >= 0;
+  publishedFds[slot] = fd;
+}
+
+void IpcRendezvous::exchange(const std::vector<uint32_t> &peers) {
+  FATAL_ERROR_IF(!hasRank, "IPC rendezvous rank was not set");
+
+  Timer timer{};
+  timer.measureStart();
+
+  std::vector<uint32_t> uniquePeers = peers;
+  std::sort(uniquePeers.begin(), uniquePeers.end());
+  uniquePeers.erase(std::unique(uniquePeers.begin(), uniquePeers.end()),
+                    uniquePeers.end());
+  uniquePeers.erase(
+      std::remove(uniquePeers.begin(), uniquePeers.end(), rank),
+      uniquePeers.end());
+
+  // Start listening before anyone tries to connect
+  int listeningSocket = -1;
+  const std::string socketName = getSocketName(rank);
+  FATAL_ERROR_IF(socketCreate(listeningSocket) != TestResult::Success ||
+                     socketBindAndListen(listeningSocket, socketName) !=
+                         TestResult::Success,
+                 "Creating IPC rendezvous socket failed, ",
+                 getErrorFromErrno());
+  getParticipant(rank).requestsCount = 0;
+  barrier();
+
+  // Connections land in the backlog of the listening peer, so requesting
+  // descriptors from all peers up front cannot deadlock
+  std::vector<int> peerSockets = {};
+  for (uint32_t peer : uniquePeers) {
+    int peerSocket = -1;
+    FATAL_ERROR_IF(socketCreate(peerSocket) != TestResult::Success ||
+                       socketConnect(peerSocket, getSocketName(peer)) !=
+                           TestResult::Success,
+                   "Connecting to IPC rendezvous peer ", peer, " failed");
+    getParticipant(peer).requestsCount++;
+    peerSockets.push_back(peerSocket);
+  }
+  barrier();
+  FATAL_ERROR_IF_SYS_CALL_FAILED(unlink(socketName.c_str()),
+                                 "Removing IPC rendezvous socket failed");
+
+  // Send all descriptors of this rank in a single message per requester
+  std::vector<int> fdsToSend = {};
+  std::copy_if(publishedFds.begin(), publishedFds.end(),
+               std::back_inserter(fdsToSend), [](int fd) { return fd >= 0; });
+  for (auto i = 0u; i < getParticipant(rank).requestsCount; i++) {
+    // Served requesters may already close their end, so only the listening
+    // socket is waited on
+    std::vector<int> acceptedSockets = {};
+    int requesterSocket = -1;
+    uint32_t senderRank = rank;
+    FATAL_ERROR_IF(socketAccept(listeningSocket, acceptedSockets,
+                                requesterSocket) != TestResult::Success ||
+                       socketSendDataWithFds(requesterSocket, fdsToSend,
+                                             &senderRank,
+                                             sizeof(senderRank)) !=
+                           TestResult::Success,
+                   "Sending descriptors to IPC rendezvous peer failed");
+    FATAL_ERROR_IF_SYS_CALL_FAILED(close(requesterSocket),
+                                   "closing socket failed");
+  }
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(listeningSocket),
+                                 "closing socket failed");
+
+  // Receive descriptors of peers. They come in the order of published slots.
+  for (auto peerIndex = 0u; peerIndex < uniquePeers.size(); peerIndex++) {
+    const uint32_t peer = uniquePeers[peerIndex];
+    std::vector<uint32_t> slotsWithFd = {};
+    for (auto slot = 0u; slot < getSlotsCount(); slot++) {
+      if (getSlot(peer, slot).hasFd) {
+        slotsWithFd.push_back(slot);
+      }
+    }
+
+    std::vector<int> fds(slotsWithFd.size(), -1);
+    uint32_t senderRank = {};
+    FATAL_ERROR_IF(socketRecvDataWithFds(peerSockets[peerIndex], fds,
+                                         &senderRank, sizeof(senderRank)) !=
+                           TestResult::Success ||
+                       senderRank != peer,
+                   "Receiving descriptors from IPC rendezvous peer ", peer,
+                   " failed");
+    for (auto slot = 0u; slot < getSlotsCount(); slot++) {
+      int &receivedFd = receivedFds[peer * getSlotsCount() + slot];
+      if (receivedFd >= 0) {
+        FATAL_ERROR_IF_SYS_CALL_FAILED(close(receivedFd),
+                                       "closing descriptor failed");
+        receivedFd = -1;
+      }
+      std::memcpy(&receivedData[(peer * getSlotsCount() + slot) * maxSlotSize],
+                  getSlot(peer, slot).data, maxSlotSize);
+    }
+    for (auto i = 0u; i < slotsWithFd.size(); i++) {
+      receivedFds[peer * getSlotsCount() + slotsWithFd[i]] = fds[i];
+    }
+    FATAL_ERROR_IF_SYS_CALL_FAILED(close(peerSockets[peerIndex]),
+                                   "closing socket failed");
+  }
+
+  // Peers may publish slots for their next exchange right after this one, so
+  // nobody leaves before all data was copied
+  barrier();
+
+  timer.measureEnd();
+  getParticipant(rank).exchangeTimeNs +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timer.get())
+          .count();
+}
+
+const void *IpcRendezvous::getData(uint32_t participantRank,
+                                   uint32_t slot) const {
+  FATAL_ERROR_IF(!hasRank, "IPC rendezvous rank was not set");
+  getSlot(participantRank, slot);
+  return &receivedData[(participantRank * getSlotsCount() + slot) *
+                       maxSlotSize];
+}
+
+int IpcRendezvous::getFd(uint32_t participantRank, uint32_t slot) const {
+  FATAL_ERROR_IF(!hasRank, "IPC rendezvous rank was not set");
+  getSlot(participantRank, slot);
+  return receivedFds[participantRank * getSlotsCount() + slot];
+}
+
+std::chrono::nanoseconds
+IpcRendezvous::getExchangeTime(uint32_t participantRank) const {
+  return std::chrono::nanoseconds(
+      getParticipant(participantRank).exchangeTimeNs.load());
+}
+
+void IpcRendezvous::barrier() {
+  const uint32_t generation = directory->barrierGeneration.load();
+  if (directory->barrierArrived.fetch_add(1) + 1 ==
+      directory->participantsCount) {
+    directory->barrierArrived = 0;
+    directory->barrierGeneration++;
+    return;
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() + barrierTimeout;
+  while (directory->barrierGeneration.load() == generation) {
+    FATAL_ERROR_IF(std::chrono::steady_clock::now() > deadline,
+                   "Timed out waiting for IPC rendezvous peers");
+    std::this_thread::yield();
+  }
+}
+
+std::string IpcRendezvous::getSocketName(uint32_t participantRank) const {
+  return "/tmp/ipc_rendezvous_" + std::to_string(directory->creatorPid) + "_" +
+         std::to_string(participantRank) + ".socket";
+}
+
+void IpcRendezvous::closeReceivedFds() {
+  for (int fd : receivedFds) {
+    if (fd >= 0) {
+      FATAL_ERROR_IF_SYS_CALL_FAILED(close(fd), "closing descriptor failed");
+    }
+  }
+  receivedFds.clear();
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+// Exchanges small binary descriptors (e.g. IPC handles of device allocations)
+// together with the file descriptors they refer to, between a group of
+// processes. Descriptors are published in a shared-memory directory keyed by
+// participant rank and slot. File descriptors are passed with one batched
+// SCM_RIGHTS message per pair of peers, so the setup cost does not depend on
+// the number of slots.
+//
+// The directory is created by the parent process and its descriptor is passed
+// to the children with Process::addHandleForInheritance(). The parent does not
+// have to participate in the exchange, unless it publishes slots itself.
+class IpcRendezvous {
+public:
+  constexpr static size_t maxSlotSize = 64;
+  constexpr static uint32_t maxSlotsCount = 64;
+
+  // Creates a new directory
+  IpcRendezvous(uint32_t participantsCount, uint32_t slotsCount);
+  // Maps a directory created by another process
+  explicit IpcRendezvous(int directoryFd);
+  IpcRendezvous(const IpcRendezvous &) = delete;
+  IpcRendezvous &operator=(const IpcRendezvous &) = delete;
+  ~IpcRendezvous() noexcept(false);
+
+  int getDirectoryFd() const { return directoryFd; }
+  uint32_t getParticipantsCount() const;
+  uint32_t getSlotsCount() const;
+
+  // Must be called before any publish() or exchange() in this process
+  void setRank(uint32_t newRank);
+
+  // Publishes data of a slot of the current rank. The fd, if not negative, is
+  // sent to peers requesting this rank. Ownership stays with the caller.
+  void publish(uint32_t slot, const void *data, size_t size, int fd);
+
+  // Collective operation performed by all participants. Makes slots of the
+  // given peers available through getData() and getFd(). Descriptors received
+  // from the same peers in a previous exchange are closed.
+  void exchange(const std::vector<uint32_t> &peers);
+
+  // Data and received descriptor of a slot of a peer, as of the last
+  // exchange() requesting that peer. Descriptors stay owned by the rendezvous
+  // object and are closed with it.
+  const void *getData(uint32_t rank, uint32_t slot) const;
+  int getFd(uint32_t rank, uint32_t slot) const;
+
+  // Time the given participant spent in its last exchange(). Available for all
+  // participants after everyone has returned from exchange().
+  std::chrono::nanoseconds getExchangeTime(uint32_t rank) const;
+
+private:
+  struct Directory;
+  struct Participant;
+  struct Slot;
+
+  static size_t getDirectorySize(uint32_t participantsCount,
+                                 uint32_t slotsCount);
+  void mapDirectory(size_t size);
+  Participant &getParticipant(uint32_t participantRank) const;
+  Slot &getSlot(uint32_t participantRank, uint32_t slot) const;
+  void barrier();
+  std::string getSocketName(uint32_t participantRank) const;
+  void closeReceivedFds();
+
+  int directoryFd = -1;
+  size_t directorySize = 0;
+  Directory *directory = nullptr;
+  uint32_t rank = {};
+  bool hasRank = false;
+  std::vector<int> publishedFds = {};
+  std::vector<int> receivedFds = {};
+  std::vector<uint8_t> receivedData = {};
+};
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2022-2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/test_case/test_result.h"
+
+#include <string>
+#include <sys/types.h>
+
+struct ProcessDataLinux {
+  struct ProcessPipes {
+    int pipes[2] = {};
+    const int &read = pipes[0];
+    const int &write = pipes[1];
+  };
+  ProcessPipes synchronizationPipeParentToChild = {};
+  ProcessPipes synchronizationPipeChildToParent = {};
+  ProcessPipes measurementPipe = {};
+  ProcessPipes stdOutPipe = {};
+
+  pid_t childPid = {};
+  int pidFd = -1;
+  bool ended = false;
+  bool terminated = false;
+  TestResult result = TestResult::Error;
+  std::string failureReason = {};
+  bool hasStdOut = false;
+  std::string stdOut = {};
+  bool hasMeasurements = false;
+  std::string measurements = {};
+};
@@ -0,0 +1,348 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/configuration.h"
+#include "framework/utility/linux/error.h"
+#include "framework/utility/linux/process_data_linux.h"
+#include "framework/utility/process_group.h"
+#include "framework/utility/process_synchronization_helper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <exception>
+#include <fcntl.h>
+#include <mutex>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <thread>
+#include <unistd.h>
+
+// Returns time left until the deadline in a format accepted by poll() and
+// epoll_wait(), where -1 means waiting without a limit.
+static int getWaitTimeoutMs(std::chrono::milliseconds timeout,
+                            std::chrono::steady_clock::time_point deadline) {
+  if (timeout.count() == 0) {
+    return -1;
+  }
+  const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+  return static_cast<int>(std::max<int64_t>(remaining.count(), 0));
+}
+
+static bool writeSynchronizationChar(int fd) {
+  // The child may exit at any moment. SIGPIPE is blocked for the duration of
+  // the write, so it fails with EPIPE instead of killing the benchmark.
+  sigset_t sigpipeSet{};
+  sigset_t previousSet{};
+  sigemptyset(&sigpipeSet);
+  sigaddset(&sigpipeSet, SIGPIPE);
+  FATAL_ERROR_IF(pthread_sigmask(SIG_BLOCK, &sigpipeSet, &previousSet) != 0,
+                 "Blocking SIGPIPE failed");
+
+  const char buffer = ProcessSynchronizationHelper::synchronizationChar;
+  ssize_t numberOfBytesWritten = {};
+  do {
+    numberOfBytesWritten = write(fd, &buffer, 1);
+  } while (numberOfBytesWritten == -1 && errno == EINTR);
+  const int writeErrno = errno;
+
+  const bool childClosedPipe =
+      numberOfBytesWritten == -1 && writeErrno == EPIPE;
+  if (childClosedPipe) {
+    const timespec noWait = {};
+    sigtimedwait(&sigpipeSet, nullptr, &noWait);
+  }
+  FATAL_ERROR_IF(pthread_sigmask(SIG_SETMASK, &previousSet, nullptr) != 0,
+                 "Restoring signal mask failed");
+
+  errno = writeErrno;
+  FATAL_ERROR_IF(!childClosedPipe && numberOfBytesWritten != 1,
+                 "Signalling child process failed, ", getErrorFromErrno());
+  return !childClosedPipe;
+}
+
+// Appends all data currently available in a non-blocking pipe. Returns true
+// if the write end was closed.
+static bool readAvailableData(int fd, std::string &output) {
+  const static size_t bufferSize = 4096u;
+  char buffer[bufferSize];
+  while (true) {
+    ssize_t numberOfBytesRead = read(fd, buffer, bufferSize);
+    if (numberOfBytesRead == -1 && errno == EINTR) {
+      continue;
+    }
+    if (numberOfBytesRead == -1 && errno == EAGAIN) {
+      return false;
+    }
+    FATAL_ERROR_IF_SYS_CALL_FAILED(numberOfBytesRead,
+                                   "reading a child process pipe failed");
+    if (numberOfBytesRead == 0) {
+      return true;
+    }
+    output.append(buffer, static_cast<size_t>(numberOfBytesRead));
+  }
+}
+
+void ProcessGroup::launchAll() {
+  // Creating a process takes long enough for a group of them to benefit from
+  // a few threads. More of them would only contend on the kernel.
+  constexpr static size_t maxDefaultThreadsCount = 8;
+  size_t threadsCount =
+      static_cast<size_t>(Configuration::get().processLaunchThreads);
+  if (threadsCount == 0) {
+    threadsCount = std::min<size_t>(
+        std::max(std::thread::hardware_concurrency(), 1u),
+        maxDefaultThreadsCount);
+  }
+  threadsCount = std::min(threadsCount, processes.size());
+
+  std::atomic<size_t> nextProcessIndex{0};
+  std::exception_ptr firstError = {};
+  std::mutex firstErrorMutex = {};
+  const auto launchRemainingProcesses = [&]() {
+    for (size_t processIndex = nextProcessIndex++;
+         processIndex < processes.size(); processIndex = nextProcessIndex++) {
+      try {
+        processes[processIndex].run();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock{firstErrorMutex};
+        if (!firstError) {
+          firstError = std::current_exception();
+        }
+      }
+    }
+  };
+
+  // The calling thread takes part in launching as well
+  std::vector<std::thread> threads = {};
+  for (auto threadIndex = 1u; threadIndex < threadsCount; threadIndex++) {
+    threads.emplace_back(launchRemainingProcesses);
+  }
+  launchRemainingProcesses();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+}
+
+void ProcessGroup::synchronizeAll(size_t iterationsCount) {
+  for (auto iteration = 0u; iteration < iterationsCount && !aborted;
+       iteration++) {
+    // Children report readiness in arbitrary order, so all of them are
+    // waited for at once
+    std::vector<pollfd> pollFds(processes.size());
+    for (auto processIndex = 0u; processIndex < processes.size();
+         processIndex++) {
+      auto processData = static_cast<ProcessDataLinux *>(
+          processes[processIndex].osSpecificData);
+      pollFds[processIndex].fd =
+          processData->synchronizationPipeChildToParent.read;
+      pollFds[processIndex].events = POLLIN;
+    }
+
+    size_t pendingProcesses = processes.size();
+    while (pendingProcesses > 0) {
+      const int readyCount = poll(pollFds.data(), pollFds.size(),
+                                  getWaitTimeoutMs(timeout, deadline));
+      if (readyCount == -1 && errno == EINTR) {
+        continue;
+      }
+      FATAL_ERROR_IF_SYS_CALL_FAILED(readyCount, "poll() failed");
+      if (readyCount == 0) {
+        terminateAll(TestResult::ChildProcessTimeout,
+                     "did not synchronize before --processTimeout elapsed",
+                     nullptr);
+        return;
+      }
+
+      for (auto processIndex = 0u; processIndex < processes.size();
+           processIndex++) {
+        pollfd &pollFd = pollFds[processIndex];
+        if (pollFd.fd < 0 || pollFd.revents == 0) {
+          continue;
+        }
+
+        char buffer = {};
+        ssize_t numberOfBytesRead = {};
+        do {
+          numberOfBytesRead = read(pollFd.fd, &buffer, 1u);
+        } while (numberOfBytesRead == -1 && errno == EINTR);
+        FATAL_ERROR_IF_SYS_CALL_FAILED(numberOfBytesRead,
+                                       "reading a child process pipe failed");
+        if (numberOfBytesRead == 0) {
+          // The child exited prematurely. Its exit status describes the
+          // failure, the others would wait for it forever.
+          terminateAll(TestResult::Error,
+                       "terminated after " + describeProcess(processIndex) +
+                           " exited prematurely",
+                       &processes[processIndex]);
+          return;
+        }
+        FATAL_ERROR_IF(
+            buffer != ProcessSynchronizationHelper::synchronizationChar,
+            std::string(
+                "Invalid synchronization received from child process: '") +
+                buffer + "'");
+
+        // Negative descriptors are ignored by poll()
+        pollFd.fd = -1;
+        pendingProcesses--;
+      }
+    }
+
+    for (auto processIndex = 0u; processIndex < processes.size();
+         processIndex++) {
+      auto processData = static_cast<ProcessDataLinux *>(
+          processes[processIndex].osSpecificData);
+      if (!writeSynchronizationChar(
+              processData->synchronizationPipeParentToChild.write)) {
+        terminateAll(TestResult::Error,
+                     "terminated after " + describeProcess(processIndex) +
+                         " exited prematurely",
+                     &processes[processIndex]);
+        return;
+      }
+    }
+  }
+}
+
+void ProcessGroup::waitForFinishAll() {
+  // All children are supervised at once. Their pipes are drained while they
+  // run, so a child producing a lot of output cannot block on a full pipe,
+  // and a hanging or crashed child is detected regardless of its position.
+  enum class EventSource : uint64_t { Exit, StdOut, Measurements };
+  const auto encodeEvent = [](size_t processIndex, EventSource source) {
+    return (static_cast<uint64_t>(processIndex) << 2) |
+           static_cast<uint64_t>(source);
+  };
+
+  const int epollFd = epoll_create1(EPOLL_CLOEXEC);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(epollFd, "epoll_create1() failed");
+  size_t registeredDescriptors = 0u;
+  const auto registerDescriptor = [&](int fd, uint64_t eventData) {
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u64 = eventData;
+    FATAL_ERROR_IF_SYS_CALL_FAILED(
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event), "epoll_ctl() failed");
+    registeredDescriptors++;
+  };
+  const auto unregisterDescriptor = [&](int fd) {
+    FATAL_ERROR_IF_SYS_CALL_FAILED(
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr), "epoll_ctl() failed");
+    registeredDescriptors--;
+  };
+
+  // Children without a pidfd are checked with waitpid() periodically
+  bool hasUnsupervisedProcesses = false;
+  for (auto processIndex = 0u; processIndex < processes.size();
+       processIndex++) {
+    auto processData = static_cast<ProcessDataLinux *>(
+        processes[processIndex].osSpecificData);
+    for (auto source : {EventSource::StdOut, EventSource::Measurements}) {
+      const bool isStdOut = source == EventSource::StdOut;
+      if (isStdOut ? processData->hasStdOut : processData->hasMeasurements) {
+        continue;
+      }
+      const int fd = isStdOut ? processData->stdOutPipe.read
+                              : processData->measurementPipe.read;
+      const int flags = fcntl(fd, F_GETFL);
+      FATAL_ERROR_IF_SYS_CALL_FAILED(flags, "fcntl() failed");
+      FATAL_ERROR_IF_SYS_CALL_FAILED(fcntl(fd, F_SETFL, flags | O_NONBLOCK),
+                                     "fcntl() failed");
+      registerDescriptor(fd, encodeEvent(processIndex, source));
+    }
+    if (!processData->ended) {
+      if (processData->pidFd >= 0) {
+        registerDescriptor(processData->pidFd,
+                           encodeEvent(processIndex, EventSource::Exit));
+      } else {
+        hasUnsupervisedProcesses = true;
+      }
+    }
+  }
+
+  constexpr static int waitpidPollingPeriodMs = 10;
+  std::vector<epoll_event> events(registeredDescriptors + 1);
+  while (registeredDescriptors > 0 || hasUnsupervisedProcesses) {
+    int waitTimeoutMs = getWaitTimeoutMs(timeout, deadline);
+    if (hasUnsupervisedProcesses &&
+        (waitTimeoutMs == -1 || waitTimeoutMs > waitpidPollingPeriodMs)) {
+      waitTimeoutMs = waitpidPollingPeriodMs;
+    }
+
+    const int eventsCount = epoll_wait(epollFd, events.data(),
+                                       static_cast<int>(events.size()),
+                                       waitTimeoutMs);
+    if (eventsCount == -1 && errno == EINTR) {
+      continue;
+    }
+    FATAL_ERROR_IF_SYS_CALL_FAILED(eventsCount, "epoll_wait() failed");
+
+    for (auto eventIndex = 0; eventIndex < eventsCount; eventIndex++) {
+      const uint64_t eventData = events[eventIndex].data.u64;
+      const size_t processIndex = static_cast<size_t>(eventData >> 2);
+      Process &process = processes[processIndex];
+      auto processData =
+          static_cast<ProcessDataLinux *>(process.osSpecificData);
+      switch (static_cast<EventSource>(eventData & 0x3)) {
+      case EventSource::Exit:
+        process.waitForFinish();
+        unregisterDescriptor(processData->pidFd);
+        break;
+      case EventSource::StdOut:
+        if (readAvailableData(processData->stdOutPipe.read,
+                              processData->stdOut)) {
+          processData->hasStdOut = true;
+          unregisterDescriptor(processData->stdOutPipe.read);
+        }
+        break;
+      case EventSource::Measurements:
+        if (readAvailableData(processData->measurementPipe.read,
+                              processData->measurements)) {
+          processData->hasMeasurements = true;
+          unregisterDescriptor(processData->measurementPipe.read);
+        }
+        break;
+      }
+    }
+
+    if (hasUnsupervisedProcesses) {
+      hasUnsupervisedProcesses = false;
+      for (Process &process : processes) {
+        auto processData =
+            static_cast<ProcessDataLinux *>(process.osSpecificData);
+        if (processData->pidFd < 0 && !process.tryWaitForFinish()) {
+          hasUnsupervisedProcesses = true;
+        }
+      }
+    }
+
+    if (getWaitTimeoutMs(timeout, deadline) == 0) {
+      // Keep whatever output was produced so far, so it can be inspected
+      terminateAll(TestResult::ChildProcessTimeout,
+                   "did not finish before --processTimeout elapsed", nullptr);
+      for (Process &process : processes) {
+        auto processData =
+            static_cast<ProcessDataLinux *>(process.osSpecificData);
+        readAvailableData(processData->stdOutPipe.read, processData->stdOut);
+        readAvailableData(processData->measurementPipe.read,
+                          processData->measurements);
+        processData->hasStdOut = true;
+        processData->hasMeasurements = true;
+      }
+      break;
+    }
+  }
+
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(epollFd), "closing epoll failed");
+}
@@ -7,150 +7,277 @@
 
 #include "framework/utility/error.h"
 #include "framework/utility/linux/error.h"
+#include "framework/utility/linux/process_data_linux.h"
 #include "framework/utility/process.h"
 #include "framework/utility/process_synchronization_helper.h"
 
+#include <algorithm>
+#include <csignal>
+#include <cstring>
 #include <fcntl.h>
 #include <memory>
+#include <spawn.h>
 #include <sstream>
+#include <string_view>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
-struct ProcessDataLinux {
-  struct ProcessPipes {
-    int pipes[2] = {};
-    const int &read = pipes[0];
-    const int &write = pipes[1];
-  };
-  ProcessPipes synchronizationPipeParentToChild = {};
-  ProcessPipes synchronizationPipeChildToParent = {};
-  ProcessPipes measurementPipe = {};
-  ProcessPipes stdOutPipe = {};
-
-  pid_t childPid = {};
-  bool ended = false;
-  TestResult result = TestResult::Error;
-  bool hasStdOut = false;
-  std::string stdOut = {};
-  bool hasMeasurements = false;
-  std::string measurements = {};
-};
+#ifdef USE_PIDFD
+#include <sys/syscall.h>
+#endif // USE_PIDFD
+
+static std::vector<std::string> prepareArgumentsForExec(
+    const std::vector<std::pair<std::string, std::string>> &arguments) {
+  std::vector<std::string> argumentsForExecStrings = {};
+  argumentsForExecStrings.reserve(arguments.size());
+  for (auto &argument : arguments) {
+    std::string str = argument.first;
+    if (!argument.second.empty()) {
+      str += "=";
+      str += argument.second;
+    }
+    argumentsForExecStrings.push_back(std::move(str));
+  }
+  return argumentsForExecStrings;
+}
 
-void Process::run() {
-  auto processDataLinux = std::make_unique<ProcessDataLinux>();
+static std::vector<std::string> prepareEnvironmentForExec(
+    const std::vector<std::pair<std::string, std::string>> &envVariables) {
+  // Start with the environment of the current process and override
+  // variables requested by the caller, the same way setenv() would.
+  extern char **environ;
+  std::vector<std::string> environmentStrings = {};
+  for (char **entry = environ; *entry != nullptr; entry++) {
+    const std::string_view entryView{*entry};
+    const auto isOverridden = [&entryView](const auto &envVariable) {
+      const std::string &key = envVariable.first;
+      return entryView.size() > key.size() && entryView[key.size()] == '=' &&
+             entryView.compare(0, key.size(), key) == 0;
+    };
+    if (std::none_of(envVariables.begin(), envVariables.end(), isOverridden)) {
+      environmentStrings.emplace_back(entryView);
+    }
+  }
+  for (auto &envVariable : envVariables) {
+    environmentStrings.push_back(envVariable.first + "=" + envVariable.second);
+  }
+  return environmentStrings;
+}
 
-  // Create pipes for stdout and stdin of the child process.
-  FATAL_ERROR_IF_SYS_CALL_FAILED(
-      pipe(processDataLinux->synchronizationPipeParentToChild.pipes),
-      "Creating pipe failed, ");
-  FATAL_ERROR_IF_SYS_CALL_FAILED(
-      pipe(processDataLinux->synchronizationPipeChildToParent.pipes),
-      "Creating pipe failed, ");
-  FATAL_ERROR_IF_SYS_CALL_FAILED(pipe(processDataLinux->measurementPipe.pipes),
-                                 "Creating pipe failed, ");
-  FATAL_ERROR_IF_SYS_CALL_FAILED(pipe(processDataLinux->stdOutPipe.pipes),
-                                 "Creating pipe failed, ");
+static std::vector<char *> toNullTerminatedArray(
+    std::vector<std::string> &strings) {
+  std::vector<char *> result = {};
+  result.reserve(strings.size() + 1);
+  for (auto &string : strings) {
+    result.push_back(string.data());
+  }
+  result.push_back(nullptr);
+  return result;
+}
 
+static void launchWithFork(ProcessDataLinux &processDataLinux,
+                           const std::string &exeName, char **argv,
+                           char **envp,
+                           const std::vector<int> &handlesForInheritance) {
   // Fork the process
-  processDataLinux->childPid = fork();
-  FATAL_ERROR_IF(processDataLinux->childPid == -1, "Creating process failed");
-
-  // Different behaviour for parent and slave process
-  if (processDataLinux->childPid != 0) {
+  processDataLinux.childPid = fork();
+  FATAL_ERROR_IF(processDataLinux.childPid == -1, "Creating process failed");
+  if (processDataLinux.childPid != 0) {
     // We're in parent process
+    return;
+  }
 
-    // Close pipes that we won't need (these are descriptors, which will be used
-    // by child)
-    FATAL_ERROR_IF_SYS_CALL_FAILED(
-        close(processDataLinux->synchronizationPipeParentToChild.read),
-        "closing pipe failed");
-    FATAL_ERROR_IF_SYS_CALL_FAILED(
-        close(processDataLinux->synchronizationPipeChildToParent.write),
-        "closing pipe failed");
-    FATAL_ERROR_IF_SYS_CALL_FAILED(
-        close(processDataLinux->measurementPipe.write), "closing pipe failed");
-    FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.write),
-                                   "closing pipe failed");
+  // We're in child process
 
-    // Store all data in Process class
-    this->osSpecificData = processDataLinux.release();
-  } else {
-    // We're in child process
+  // Redirect stdout to our pipe
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      dup2(processDataLinux.stdOutPipe.write, STDOUT_FILENO),
+      "dup2 for stdout failed");
 
-    // Redirect stdout to our pipe
-    FATAL_ERROR_IF_SYS_CALL_FAILED(
-        dup2(processDataLinux->stdOutPipe.write, STDOUT_FILENO),
-        "dup2 for stdout failed");
+  // Close pipes that we won't need (these are descriptors, which will be used
+  // by parent)
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      close(processDataLinux.synchronizationPipeParentToChild.write),
+      "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      close(processDataLinux.synchronizationPipeChildToParent.read),
+      "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux.measurementPipe.read),
+                                 "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux.stdOutPipe.read),
+                                 "closing pipe failed");
 
-    // Close pipes that we won't need (these are descriptors, which will be used
-    // by parent)
-    FATAL_ERROR_IF_SYS_CALL_FAILED(
-        close(processDataLinux->synchronizationPipeParentToChild.write),
-        "closing pipe failed");
+  // Enable inheritance for pipe endpoints used by the workload and for
+  // requested handles. Nothing is allocated here, because other threads of
+  // the parent may have been holding locks when it forked.
+  const auto enableInheritance = [](int handle) {
+    int currentFlags = fcntl(handle, F_GETFD);
     FATAL_ERROR_IF_SYS_CALL_FAILED(
-        close(processDataLinux->synchronizationPipeChildToParent.read),
-        "closing pipe failed");
+        currentFlags, "Failed getting descriptor flags for fd=", handle)
     FATAL_ERROR_IF_SYS_CALL_FAILED(
-        close(processDataLinux->measurementPipe.read), "closing pipe failed");
-    FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.read),
-                                   "closing pipe failed");
-
-    // Below pipe endpoints will be explicitly used by the child workload and
-    // they should be closed by it.
-    this->addArgument(
-        "synchronizationPipeIn",
-        std::to_string(
-            processDataLinux->synchronizationPipeParentToChild.read));
-    this->addArgument(
-        "synchronizationPipeOut",
-        std::to_string(
-            processDataLinux->synchronizationPipeChildToParent.write));
-    this->addArgument("measurementPipe",
-                      std::to_string(processDataLinux->measurementPipe.write));
-
-    // Prepare arguments
-    std::vector<std::string> argumentsForExecStrings = {};
-    argumentsForExecStrings.reserve(this->arguments.size());
-    for (auto &argument : this->arguments) {
-      std::string str = argument.first;
-      if (!argument.second.empty()) {
-        str += "=";
-        str += argument.second;
-      }
-      argumentsForExecStrings.push_back(std::move(str));
-    }
-    std::vector<char *> argumentsForExec = {};
-    argumentsForExec.reserve(argumentsForExecStrings.size() + 1);
-    for (auto &argumentsForExecString : argumentsForExecStrings) {
-      argumentsForExec.push_back(argumentsForExecString.data());
-    }
-    argumentsForExec.push_back(nullptr);
+        fcntl(handle, F_SETFD, currentFlags & ~FD_CLOEXEC),
+        "Failed getting descriptor flags for fd=", handle);
+  };
+  enableInheritance(processDataLinux.synchronizationPipeParentToChild.read);
+  enableInheritance(processDataLinux.synchronizationPipeChildToParent.write);
+  enableInheritance(processDataLinux.measurementPipe.write);
+  for (int handle : handlesForInheritance) {
+    enableInheritance(handle);
+  }
+
+  // Load new binary image
+  const int execResult = execve(exeName.c_str(), argv, envp);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(execResult, "Sys call execve failed, ");
+  FATAL_ERROR("Unreachable code after execve");
+}
 
-    // Prepare environment
-    for (auto &envVariable : this->envVariables) {
-      FATAL_ERROR_IF_SYS_CALL_FAILED(
-          setenv(envVariable.first.c_str(), envVariable.second.c_str(), 1),
-          "setenv failed");
+static void
+launchWithPosixSpawn(ProcessDataLinux &processDataLinux,
+                     const std::string &exeName, char **argv, char **envp,
+                     const std::vector<int> &handlesForInheritance) {
+  // posix_spawn does not copy page tables of the parent, so its cost does not
+  // depend on how much memory the benchmark has mapped. All descriptor
+  // manipulations, which fork path performs in the child, are described as
+  // file actions instead.
+  posix_spawn_file_actions_t fileActions{};
+  int result = posix_spawn_file_actions_init(&fileActions);
+  FATAL_ERROR_IF(result != 0, "posix_spawn_file_actions_init failed, ",
+                 strerror(result));
+
+  const int closedInChild[] = {
+      processDataLinux.synchronizationPipeParentToChild.write,
+      processDataLinux.synchronizationPipeChildToParent.read,
+      processDataLinux.measurementPipe.read,
+      processDataLinux.stdOutPipe.read,
+  };
+  result = posix_spawn_file_actions_adddup2(
+      &fileActions, processDataLinux.stdOutPipe.write, STDOUT_FILENO);
+  for (int fd : closedInChild) {
+    if (result == 0) {
+      result = posix_spawn_file_actions_addclose(&fileActions, fd);
     }
+  }
 
-    // Enable inheritance for requested handles
-    for (int handle : handlesForInheritance) {
-      int currentFlags = fcntl(handle, F_GETFD);
-      FATAL_ERROR_IF_SYS_CALL_FAILED(
-          currentFlags, "Failed getting descriptor flags for fd=", handle)
-      FATAL_ERROR_IF_SYS_CALL_FAILED(
-          fcntl(handle, F_SETFD, currentFlags & ~FD_CLOEXEC),
-          "Failed getting descriptor flags for fd=", handle);
+  // Duplicating a descriptor onto itself clears its FD_CLOEXEC flag
+  const int inheritedPipes[] = {
+      processDataLinux.synchronizationPipeParentToChild.read,
+      processDataLinux.synchronizationPipeChildToParent.write,
+      processDataLinux.measurementPipe.write,
+  };
+  for (int fd : inheritedPipes) {
+    if (result == 0) {
+      result = posix_spawn_file_actions_adddup2(&fileActions, fd, fd);
     }
+  }
+  for (int handle : handlesForInheritance) {
+    if (result == 0) {
+      result = posix_spawn_file_actions_adddup2(&fileActions, handle, handle);
+    }
+  }
+  FATAL_ERROR_IF(result != 0, "Preparing posix_spawn file actions failed, ",
+                 strerror(result));
+
+  pid_t childPid = {};
+  result = posix_spawn(&childPid, exeName.c_str(), &fileActions, nullptr, argv,
+                       envp);
+  posix_spawn_file_actions_destroy(&fileActions);
+  FATAL_ERROR_IF(result != 0, "Creating process with posix_spawn failed, ",
+                 strerror(result));
+  processDataLinux.childPid = childPid;
+}
+
+void Process::run() {
+  auto processDataLinux = std::make_unique<ProcessDataLinux>();
 
-    // Load new binary image
-    extern char **environ;
-    const int execResult =
-        execve(this->exeName.c_str(), argumentsForExec.data(), environ);
-    FATAL_ERROR_IF_SYS_CALL_FAILED(execResult, "Sys call execve failed, ");
-    FATAL_ERROR("Unreachable code after execve");
+  // Create pipes for stdout and stdin of the child process. ProcessGroup may
+  // create several children concurrently, so all descriptors are created as
+  // close-on-exec. Otherwise one child could inherit pipes of another one and
+  // keep them open after the other one exits.
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      pipe2(processDataLinux->synchronizationPipeParentToChild.pipes,
+            O_CLOEXEC),
+      "Creating pipe failed, ");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      pipe2(processDataLinux->synchronizationPipeChildToParent.pipes,
+            O_CLOEXEC),
+      "Creating pipe failed, ");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      pipe2(processDataLinux->measurementPipe.pipes, O_CLOEXEC),
+      "Creating pipe failed, ");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      pipe2(processDataLinux->stdOutPipe.pipes, O_CLOEXEC),
+      "Creating pipe failed, ");
+
+  // Below pipe endpoints will be explicitly used by the child workload and
+  // they should be closed by it.
+  auto argumentsForChild = this->arguments;
+  argumentsForChild.emplace_back(
+      "--synchronizationPipeIn",
+      std::to_string(processDataLinux->synchronizationPipeParentToChild.read));
+  argumentsForChild.emplace_back(
+      "--synchronizationPipeOut",
+      std::to_string(processDataLinux->synchronizationPipeChildToParent.write));
+  argumentsForChild.emplace_back(
+      "--measurementPipe",
+      std::to_string(processDataLinux->measurementPipe.write));
+
+  // Prepare arguments and environment. It is done before creating the child,
+  // so the child does not have to allocate anything before execve.
+  std::vector<std::string> argumentsForExecStrings =
+      prepareArgumentsForExec(argumentsForChild);
+  std::vector<char *> argumentsForExec =
+      toNullTerminatedArray(argumentsForExecStrings);
+  std::vector<std::string> environmentForExecStrings =
+      prepareEnvironmentForExec(this->envVariables);
+  std::vector<char *> environmentForExec =
+      toNullTerminatedArray(environmentForExecStrings);
+
+  // Create the child process. Both launchers make the child inherit CPU
+  // affinity and memory policy of the calling thread, so the placement is
+  // applied here temporarily.
+  {
+    ScopedCpuPlacement scopedCpuPlacement{this->cpuPlacement};
+    switch (this->launcher) {
+    case ProcessLauncher::Fork:
+      launchWithFork(*processDataLinux, this->exeName, argumentsForExec.data(),
+                     environmentForExec.data(), handlesForInheritance);
+      break;
+    case ProcessLauncher::PosixSpawn:
+      launchWithPosixSpawn(*processDataLinux, this->exeName,
+                           argumentsForExec.data(), environmentForExec.data(),
+                           handlesForInheritance);
+      break;
+    default:
+      FATAL_ERROR("Unknown process launcher");
+    }
   }
+
+  // We're in parent process
+
+  // Close pipes that we won't need (these are descriptors, which will be used
+  // by child)
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      close(processDataLinux->synchronizationPipeParentToChild.read),
+      "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      close(processDataLinux->synchronizationPipeChildToParent.write),
+      "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->measurementPipe.write),
+                                 "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.write),
+                                 "closing pipe failed");
+
+#ifdef USE_PIDFD
+  // Descriptor becomes readable when the child exits, which allows
+  // ProcessGroup to supervise all children with a single epoll. Older kernels
+  // do not support it, in which case the children are polled with waitpid().
+  processDataLinux->pidFd =
+      static_cast<int>(syscall(SYS_pidfd_open, processDataLinux->childPid, 0));
+#endif // USE_PIDFD
+
+  // Store all data in Process class
+  this->osSpecificData = processDataLinux.release();
 }
 
 void Process::freeOsSpecificData() {
@@ -160,6 +287,11 @@ void Process::freeOsSpecificData() {
     return;
   }
 
+  // Do not leave running children behind, e.g. when the test returned early
+  if (!processDataLinux->ended) {
+    terminate(TestResult::Error, "terminated before finishing its work");
+  }
+
   // Close pipes, that were used by the parent
   FATAL_ERROR_IF_SYS_CALL_FAILED(
       close(processDataLinux->synchronizationPipeParentToChild.write),
@@ -169,34 +301,98 @@ void Process::freeOsSpecificData() {
       "closing pipe failed");
   FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->measurementPipe.read),
                                  "closing pipe failed");
+  FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->stdOutPipe.read),
+                                 "closing pipe failed");
+  if (processDataLinux->pidFd >= 0) {
+    FATAL_ERROR_IF_SYS_CALL_FAILED(close(processDataLinux->pidFd),
+                                   "closing pidfd failed");
+  }
 
   delete processDataLinux;
 }
 
-void Process::waitForFinish() {
-  ProcessDataLinux *processDataLinux =
-      static_cast<ProcessDataLinux *>(this->osSpecificData);
-  if (processDataLinux->ended) {
-    return;
+static void storeExitStatus(ProcessDataLinux &processDataLinux, int status) {
+  // Result of a process killed by the parent was already set by terminate()
+  if (!processDataLinux.terminated) {
+    if (WIFEXITED(status)) {
+      processDataLinux.result = static_cast<TestResult>(WEXITSTATUS(status));
+    } else {
+      const int signal = WTERMSIG(status);
+      processDataLinux.result = TestResult::ChildProcessCrashed;
+      processDataLinux.failureReason = "killed by signal " +
+                                       std::to_string(signal) + " (" +
+                                       strsignal(signal) + ")";
+    }
   }
+  processDataLinux.ended = true;
+}
 
+static bool waitForChild(ProcessDataLinux &processDataLinux, bool blocking) {
   while (true) {
     int status{};
-    int pid = waitpid(processDataLinux->childPid, &status, 0);
+    const int options = blocking ? 0 : WNOHANG;
+    int pid = waitpid(processDataLinux.childPid, &status, options);
+    if (pid == -1 && errno == EINTR) {
+      continue;
+    }
     FATAL_ERROR_IF(pid == -1, std::string("waitpid() returned an error, ") +
                                   getErrorFromErrno());
-    FATAL_ERROR_IF(pid != processDataLinux->childPid,
+    if (pid == 0) {
+      return false;
+    }
+    FATAL_ERROR_IF(pid != processDataLinux.childPid,
                    "waitpid() signalled from wrong child process");
-    FATAL_ERROR_IF(WIFSIGNALED(status), "child process killed by signal")
-    FATAL_ERROR_IF(WIFSTOPPED(status), "child process stopped by signal")
 
-    if (WIFEXITED(status)) {
-      processDataLinux->result = static_cast<TestResult>(WEXITSTATUS(status));
-      break;
+    if (WIFEXITED(status) || WIFSIGNALED(status)) {
+      storeExitStatus(processDataLinux, status);
+      return true;
     }
   }
+}
+
+void Process::waitForFinish() {
+  ProcessDataLinux *processDataLinux =
+      static_cast<ProcessDataLinux *>(this->osSpecificData);
+  if (processDataLinux->ended) {
+    return;
+  }
+
+  waitForChild(*processDataLinux, true);
+}
+
+bool Process::tryWaitForFinish() {
+  ProcessDataLinux *processDataLinux =
+      static_cast<ProcessDataLinux *>(this->osSpecificData);
+  if (processDataLinux->ended) {
+    return true;
+  }
+
+  return waitForChild(*processDataLinux, false);
+}
+
+void Process::terminate(TestResult result, const std::string &reason) {
+  ProcessDataLinux *processDataLinux =
+      static_cast<ProcessDataLinux *>(this->osSpecificData);
+
+  // A child, which has already exited, keeps its own result
+  if (tryWaitForFinish()) {
+    return;
+  }
 
-  processDataLinux->ended = true;
+  processDataLinux->terminated = true;
+  processDataLinux->result = result;
+  processDataLinux->failureReason = reason;
+  FATAL_ERROR_IF(kill(processDataLinux->childPid, SIGKILL) == -1 &&
+                     errno != ESRCH,
+                 std::string("kill() returned an error, ") +
+                     getErrorFromErrno());
+  waitForFinish();
+}
+
+bool Process::isTerminated() {
+  ProcessDataLinux *processDataLinux =
+      static_cast<ProcessDataLinux *>(this->osSpecificData);
+  return processDataLinux->terminated;
 }
 
 TestResult Process::getResult() {
@@ -206,6 +402,12 @@ TestResult Process::getResult() {
   return processDataLinux->result;
 }
 
+const std::string &Process::getFailureReason() {
+  ProcessDataLinux *processDataLinux =
+      static_cast<ProcessDataLinux *>(this->osSpecificData);
+  return processDataLinux->failureReason;
+}
+
 const static std::string
 readEntirePipe(ProcessDataLinux::ProcessPipes processPipes) {
   std::ostringstream output{};
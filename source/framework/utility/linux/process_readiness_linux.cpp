@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/error.h"
+#include "framework/utility/linux/error.h"
+#include "framework/utility/process_readiness.h"
+
+#include <ctime>
+#include <linux/futex.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static void *mapBlock(int fd, size_t size) {
+  void *address =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  FATAL_ERROR_IF(address == MAP_FAILED, "mmap of readiness block failed, ",
+                 getErrorFromErrno());
+  return address;
+}
+
+ProcessReadiness::ProcessReadiness(size_t processesCount) {
+  const int fd = memfd_create("process_readiness", MFD_CLOEXEC);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(fd, "memfd_create failed");
+  this->handle = fd;
+  this->blockSize = getBlockSize(processesCount);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(ftruncate(fd, blockSize), "ftruncate failed");
+  this->block = static_cast<Block *>(mapBlock(fd, blockSize));
+
+  // Memory of a new memfd is zeroed, so all processes start as not ready
+  this->block->processesCount = static_cast<uint32_t>(processesCount);
+}
+
+ProcessReadiness::ProcessReadiness(int64_t inheritedHandle) {
+  const int fd = static_cast<int>(inheritedHandle);
+  this->handle = fd;
+  struct stat fileStatus = {};
+  FATAL_ERROR_IF_SYS_CALL_FAILED(fstat(fd, &fileStatus), "fstat failed");
+  this->blockSize = static_cast<size_t>(fileStatus.st_size);
+  FATAL_ERROR_IF(blockSize < getBlockSize(0), "Invalid readiness block");
+  this->block = static_cast<Block *>(mapBlock(fd, blockSize));
+  FATAL_ERROR_IF(blockSize != getBlockSize(block->processesCount),
+                 "Invalid readiness block");
+}
+
+ProcessReadiness::~ProcessReadiness() noexcept(false) {
+  if (block != nullptr) {
+    FATAL_ERROR_IF_SYS_CALL_FAILED(munmap(block, blockSize), "munmap failed");
+  }
+  if (handle >= 0) {
+    FATAL_ERROR_IF_SYS_CALL_FAILED(close(static_cast<int>(handle)),
+                                   "closing readiness block failed");
+  }
+}
+
+void ProcessReadiness::reportReady(size_t processIndex) {
+  const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      Clock::now().time_since_epoch());
+  getReadyTimeNs(processIndex).store(now.count(), std::memory_order_release);
+  block->readyCount.fetch_add(1, std::memory_order_acq_rel);
+
+  // The counter is shared between processes, so a non-private futex is used
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&block->readyCount),
+          FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+}
+
+void ProcessReadiness::waitForChange(size_t observedReadyCount,
+                                     std::chrono::milliseconds timeout) const {
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  const timespec relativeTimeout = {
+      static_cast<time_t>(seconds.count()),
+      static_cast<long>(std::chrono::nanoseconds(timeout - seconds).count())};
+
+  // Spurious wakeups, EAGAIN and timeouts are all handled by the caller, which
+  // checks the counter again
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&block->readyCount),
+          FUTEX_WAIT, static_cast<uint32_t>(observedReadyCount),
+          &relativeTimeout, nullptr, 0);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_topology.h"
+#include "framework/utility/system_noise.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+static std::string readSysfsLine(const std::string &path) {
+  std::ifstream file{path};
+  std::string line{};
+  std::getline(file, line);
+  return line;
+}
+
+std::vector<SystemNoise::Finding> SystemNoise::auditSettings() {
+  std::vector<Finding> findings{};
+  const std::string cpuPath = "/sys/devices/system/cpu/";
+
+  // Frequency of other governors follows the load, which the benchmark itself
+  // changes
+  if (const std::string governor =
+          readSysfsLine(cpuPath + "cpu0/cpufreq/scaling_governor");
+      !governor.empty()) {
+    findings.push_back({"governor", governor, governor != "performance"});
+  }
+
+  // Turbo frequency depends on temperature and the number of busy cores
+  if (const std::string noTurbo =
+          readSysfsLine(cpuPath + "intel_pstate/no_turbo");
+      !noTurbo.empty()) {
+    const bool turbo = noTurbo == "0";
+    findings.push_back({"turbo", turbo ? "on" : "off", turbo});
+  } else if (const std::string boost = readSysfsLine(cpuPath + "cpufreq/boost");
+             !boost.empty()) {
+    findings.push_back({"turbo", boost == "1" ? "on" : "off", boost == "1"});
+  }
+
+  // SMT siblings share execution units and caches of a core
+  if (const std::string smt = readSysfsLine(cpuPath + "smt/active");
+      !smt.empty()) {
+    findings.push_back({"SMT", smt == "1" ? "on" : "off", smt == "1"});
+  }
+
+  const std::string isolated = readSysfsLine(cpuPath + "isolated");
+  findings.push_back({"isolcpus", isolated.empty() ? "none" : isolated, false});
+  if (const std::string nohzFull = readSysfsLine(cpuPath + "nohz_full");
+      !nohzFull.empty() && nohzFull != "(null)") {
+    findings.push_back({"nohz_full", nohzFull, false});
+  }
+
+  if (const std::string loadAverage = readSysfsLine("/proc/loadavg");
+      !loadAverage.empty()) {
+    const std::string load = loadAverage.substr(0, loadAverage.find(' '));
+    findings.push_back({"load", load, std::atof(load.c_str()) > 1.0});
+  }
+
+  // Khugepaged compacts memory in the background when THP are always enabled
+  const std::string thp =
+      readSysfsLine("/sys/kernel/mm/transparent_hugepage/enabled");
+  const size_t thpBegin = thp.find('[');
+  const size_t thpEnd = thp.find(']');
+  if (thpBegin != std::string::npos && thpEnd > thpBegin) {
+    const std::string mode = thp.substr(thpBegin + 1, thpEnd - thpBegin - 1);
+    findings.push_back({"THP", mode, mode == "always"});
+  }
+  return findings;
+}
+
+std::vector<size_t> SystemNoise::getQuietCpus() {
+  std::vector<size_t> cpus{};
+  if (CpuTopology::parseCpuList(
+          readSysfsLine("/sys/devices/system/cpu/isolated"), cpus) &&
+      !cpus.empty()) {
+    return cpus;
+  }
+
+  // Header of /proc/interrupts names CPUs of the following columns
+  std::ifstream file{"/proc/interrupts"};
+  std::string line{};
+  std::getline(file, line);
+  std::istringstream header{line};
+  std::vector<size_t> columnCpus{};
+  for (std::string name{}; header >> name;) {
+    if (name.compare(0, 3, "CPU") == 0) {
+      columnCpus.push_back(std::strtoul(name.c_str() + 3, nullptr, 10));
+    }
+  }
+  std::vector<uint64_t> interrupts(columnCpus.size(), 0);
+  while (std::getline(file, line)) {
+    std::istringstream row{line};
+    std::string irq{};
+    row >> irq;
+    uint64_t count = 0;
+    for (size_t column = 0; column < interrupts.size() && row >> count;
+         column++) {
+      interrupts[column] += count;
+    }
+  }
+  if (columnCpus.size() < 2) {
+    return {};
+  }
+
+  std::vector<uint64_t> sorted = interrupts;
+  std::sort(sorted.begin(), sorted.end());
+  const uint64_t median = sorted[sorted.size() / 2];
+  for (size_t column = 0; column < columnCpus.size(); column++) {
+    if (interrupts[column] <= median) {
+      cpus.push_back(columnCpus[column]);
+    }
+  }
+  return cpus;
+}
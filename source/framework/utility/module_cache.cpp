@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "module_cache.h"
+
+#include "framework/configuration.h"
+#include "framework/utility/file_helper.h"
+#include "framework/utility/memory_constants.h"
+#include "framework/utility/working_directory_helper.h"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+// Files start with a header identifying the format. The version has to be
+// increased whenever the layout changes, so old files are rebuilt.
+constexpr static uint32_t fileMagic = 0x434d4243; // "CBMC"
+constexpr static uint32_t fileVersion = 1;
+constexpr static uint64_t hashSeed = 0xcbf29ce484222325ull;
+
+uint64_t ModuleCache::Key::getHash() const {
+  uint64_t result = hash(&inputHash, sizeof(inputHash), hashSeed);
+  result = hash(&inputSize, sizeof(inputSize), result);
+  result = hash(buildOptions.data(), buildOptions.size(), result);
+  return hash(deviceDescription.data(), deviceDescription.size(), result);
+}
+
+bool ModuleCache::Key::operator==(const Key &other) const {
+  return inputHash == other.inputHash && inputSize == other.inputSize &&
+         buildOptions == other.buildOptions &&
+         deviceDescription == other.deviceDescription;
+}
+
+ModuleCache::ModuleCache(size_t memoryCapacity, const std::string &directory)
+    : memoryCapacity(memoryCapacity), directory(directory) {}
+
+ModuleCache &ModuleCache::get() {
+  static ModuleCache cache{Configuration::get().moduleCacheSize *
+                               MemoryConstants::megaByte,
+                           Configuration::get().moduleCacheDir};
+  return cache;
+}
+
+uint64_t ModuleCache::hash(const void *data, size_t size, uint64_t seed) {
+  // FNV-1a, processing 8 bytes per step to keep hashing of large SPIR-V files
+  // cheap compared to their compilation
+  constexpr uint64_t prime = 0x100000001b3ull;
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  uint64_t result = seed;
+  size_t offset = 0;
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes + offset, sizeof(word));
+    result = (result ^ word) * prime;
+  }
+  for (; offset < size; offset++) {
+    result = (result ^ bytes[offset]) * prime;
+  }
+  return result ^ size;
+}
+
+ModuleCache::Key ModuleCache::createKey(const void *input, size_t inputSize,
+                                        const std::string &buildOptions,
+                                        const std::string &deviceDescription) {
+  Key key{};
+  key.inputHash = hash(input, inputSize, hashSeed);
+  key.inputSize = inputSize;
+  key.buildOptions = buildOptions;
+  key.deviceDescription = deviceDescription;
+  return key;
+}
+
+bool ModuleCache::load(const Key &key, std::vector<uint8_t> &outBinary) {
+  if (!isEnabled()) {
+    return false;
+  }
+
+  std::lock_guard lock{mutex};
+  if (loadFromMemory(key, outBinary)) {
+    statistics.memoryHits++;
+    return true;
+  }
+  if (loadFromDisk(key, outBinary)) {
+    storeInMemory(key, outBinary);
+    statistics.diskHits++;
+    return true;
+  }
+  statistics.misses++;
+  return false;
+}
+
+void ModuleCache::store(const Key &key, const std::vector<uint8_t> &binary) {
+  if (!isEnabled() || binary.empty()) {
+    return;
+  }
+
+  std::lock_guard lock{mutex};
+  storeInMemory(key, binary);
+  storeOnDisk(key, binary);
+}
+
+std::string ModuleCache::getFilePath(const Key &key) const {
+  std::ostringstream fileName{};
+  fileName << std::hex << std::setw(16) << std::setfill('0') << key.getHash()
+           << ".bin";
+  return (FileSystem::path(directory) / fileName.str()).string();
+}
+
+bool ModuleCache::loadFromMemory(const Key &key,
+                                 std::vector<uint8_t> &outBinary) {
+  const auto it = entriesByHash.find(key.getHash());
+  if (it == entriesByHash.end() || !(it->second->key == key)) {
+    return false;
+  }
+
+  entries.splice(entries.begin(), entries, it->second);
+  outBinary = it->second->binary;
+  return true;
+}
+
+void ModuleCache::storeInMemory(const Key &key,
+                                const std::vector<uint8_t> &binary) {
+  if (binary.size() > memoryCapacity) {
+    return;
+  }
+
+  // Entry with the same hash is replaced, even if it was built for a
+  // different key
+  const uint64_t keyHash = key.getHash();
+  if (const auto it = entriesByHash.find(keyHash); it != entriesByHash.end()) {
+    memoryUsage -= it->second->binary.size();
+    entries.erase(it->second);
+    entriesByHash.erase(it);
+  }
+
+  // Evict least recently used entries
+  while (memoryUsage + binary.size() > memoryCapacity) {
+    const Entry &leastRecentlyUsed = entries.back();
+    memoryUsage -= leastRecentlyUsed.binary.size();
+    entriesByHash.erase(leastRecentlyUsed.key.getHash());
+    entries.pop_back();
+  }
+
+  entries.push_front(Entry{key, binary});
+  entriesByHash[keyHash] = entries.begin();
+  memoryUsage += binary.size();
+}
+
+template <typename T>
+static void writeValue(std::ostream &stream, const T &value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+static void writeString(std::ostream &stream, const std::string &value) {
+  writeValue(stream, static_cast<uint64_t>(value.size()));
+  stream.write(value.data(), value.size());
+}
+
+template <typename T>
+static bool readValue(const uint8_t *&position, const uint8_t *end,
+                      T &outValue) {
+  if (static_cast<size_t>(end - position) < sizeof(outValue)) {
+    return false;
+  }
+  std::memcpy(&outValue, position, sizeof(outValue));
+  position += sizeof(outValue);
+  return true;
+}
+
+static bool readString(const uint8_t *&position, const uint8_t *end,
+                       std::string &outValue) {
+  uint64_t size = 0;
+  if (!readValue(position, end, size) ||
+      static_cast<uint64_t>(end - position) < size) {
+    return false;
+  }
+  outValue.assign(reinterpret_cast<const char *>(position), size);
+  position += size;
+  return true;
+}
+
+bool ModuleCache::loadFromDisk(const Key &key,
+                               std::vector<uint8_t> &outBinary) const {
+  if (directory.empty()) {
+    return false;
+  }
+
+  const std::string filePath = getFilePath(key);
+  const FileHelper::MappedFile file{filePath};
+  if (!file.isValid()) {
+    return false;
+  }
+
+  // The whole key is stored in the file and compared, so files are never used
+  // for a different input, e.g. after a hash collision or a driver update.
+  // Damaged files are removed and rebuilt.
+  const uint8_t *position = file.getData();
+  const uint8_t *end = position + file.getSize();
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  Key fileKey{};
+  uint64_t binarySize = 0;
+  uint64_t binaryHash = 0;
+  const bool headerValid =
+      readValue(position, end, magic) && magic == fileMagic &&
+      readValue(position, end, version) && version == fileVersion &&
+      readValue(position, end, fileKey.inputHash) &&
+      readValue(position, end, fileKey.inputSize) &&
+      readString(position, end, fileKey.buildOptions) &&
+      readString(position, end, fileKey.deviceDescription) &&
+      readValue(position, end, binarySize) &&
+      readValue(position, end, binaryHash) &&
+      static_cast<uint64_t>(end - position) == binarySize;
+  if (!headerValid || !(fileKey == key) ||
+      hash(position, binarySize, hashSeed) != binaryHash) {
+    std::error_code error{};
+    FileSystem::remove(filePath, error);
+    return false;
+  }
+
+  outBinary.assign(position, end);
+  return true;
+}
+
+void ModuleCache::storeOnDisk(const Key &key,
+                              const std::vector<uint8_t> &binary) const {
+  if (directory.empty()) {
+    return;
+  }
+
+  std::error_code error{};
+  FileSystem::create_directories(directory, error);
+
+  // Files are written under a unique name and then renamed, so concurrent
+  // processes never read a partially written file
+  const std::string filePath = getFilePath(key);
+  const std::string temporaryFilePath =
+      filePath + "." + std::to_string(std::random_device{}()) + ".tmp";
+  {
+    std::ofstream file{temporaryFilePath, std::ios::out | std::ios::binary};
+    if (!file.good()) {
+      return;
+    }
+    writeValue(file, fileMagic);
+    writeValue(file, fileVersion);
+    writeValue(file, key.inputHash);
+    writeValue(file, key.inputSize);
+    writeString(file, key.buildOptions);
+    writeString(file, key.deviceDescription);
+    writeValue(file, static_cast<uint64_t>(binary.size()));
+    writeValue(file, hash(binary.data(), binary.size(), hashSeed));
+    file.write(reinterpret_cast<const char *>(binary.data()), binary.size());
+    if (!file.good()) {
+      file.close();
+      FileSystem::remove(temporaryFilePath, error);
+      return;
+    }
+  }
+  FileSystem::rename(temporaryFilePath, filePath, error);
+  if (error) {
+    FileSystem::remove(temporaryFilePath, error);
+  }
+}
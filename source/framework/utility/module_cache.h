@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Cache of native binaries built by the compute APIs from SPIR-V or kernel
+// sources. Binaries are identified by everything which affects the build: the
+// input bytes, build options and a description of the device and its driver.
+// Recently used binaries are kept in memory up to the given capacity. If a
+// directory is given, all binaries are also stored there, so following
+// processes skip the compilation as well. The cache only handles bytes, the
+// compute APIs are used by the backend-specific helpers.
+class ModuleCache {
+public:
+  struct Key {
+    uint64_t inputHash = 0;
+    uint64_t inputSize = 0;
+    std::string buildOptions = {};
+    std::string deviceDescription = {};
+
+    uint64_t getHash() const;
+    bool operator==(const Key &other) const;
+  };
+
+  struct Statistics {
+    size_t memoryHits = 0;
+    size_t diskHits = 0;
+    size_t misses = 0;
+  };
+
+  ModuleCache(size_t memoryCapacity, const std::string &directory);
+
+  // Cache configured with --moduleCacheSize and --moduleCacheDir. It is
+  // disabled if both are unset.
+  static ModuleCache &get();
+  bool isEnabled() const { return memoryCapacity > 0 || !directory.empty(); }
+
+  static uint64_t hash(const void *data, size_t size, uint64_t seed);
+  static Key createKey(const void *input, size_t inputSize,
+                       const std::string &buildOptions,
+                       const std::string &deviceDescription);
+
+  // Looks up the binary in memory and then on disk. Files which are damaged
+  // or were written for a different key are treated as misses and removed.
+  bool load(const Key &key, std::vector<uint8_t> &outBinary);
+  void store(const Key &key, const std::vector<uint8_t> &binary);
+
+  const Statistics &getStatistics() const { return statistics; }
+  size_t getMemoryUsage() const { return memoryUsage; }
+  std::string getFilePath(const Key &key) const;
+
+private:
+  struct Entry {
+    Key key;
+    std::vector<uint8_t> binary;
+  };
+  using Entries = std::list<Entry>;
+
+  bool loadFromMemory(const Key &key, std::vector<uint8_t> &outBinary);
+  void storeInMemory(const Key &key, const std::vector<uint8_t> &binary);
+  bool loadFromDisk(const Key &key, std::vector<uint8_t> &outBinary) const;
+  void storeOnDisk(const Key &key, const std::vector<uint8_t> &binary) const;
+
+  const size_t memoryCapacity;
+  const std::string directory;
+
+  // Entries are ordered from the most recently used
+  Entries entries = {};
+  std::unordered_map<uint64_t, Entries::iterator> entriesByHash = {};
+  size_t memoryUsage = 0;
+  Statistics statistics = {};
+  std::mutex mutex = {};
+};
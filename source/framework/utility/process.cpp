@@ -7,19 +7,22 @@
 
 #include "process.h"
 
+#include "framework/configuration.h"
 #include "framework/utility/error.h"
 #include "framework/utility/string_utils.h"
 
 #include <iostream>
 
-Process::Process(const std::string &exeName) : exeName(exeName) {
+Process::Process(const std::string &exeName)
+    : exeName(exeName), launcher(Configuration::get().processLauncher) {
   arguments.emplace_back(exeName, std::string{});
 }
 
 Process::Process(Process &&other)
     : exeName(std::move(other.exeName)), arguments(std::move(other.arguments)),
       envVariables(std::move(other.envVariables)),
-      osSpecificData(std::move(other.osSpecificData)) {
+      osSpecificData(std::move(other.osSpecificData)),
+      launcher(other.launcher), cpuPlacement(std::move(other.cpuPlacement)) {
   other.osSpecificData = nullptr;
 }
 
@@ -30,6 +33,8 @@ Process &Process::operator=(Process &&other) {
     envVariables = std::move(other.envVariables);
     osSpecificData = std::move(other.osSpecificData);
     other.osSpecificData = nullptr;
+    launcher = other.launcher;
+    cpuPlacement = std::move(other.cpuPlacement);
   }
   return *this;
 }
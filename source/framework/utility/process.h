@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "framework/enum/process_launcher.h"
+#include "framework/utility/cpu_placement.h"
 #include "framework/test_case/test_result.h"
 
 #include <cstdint>
@@ -25,21 +27,36 @@ public:
   void addEnvVariable(const std::string &key, const std::string &value);
   void addHandleForInheritance(int handle);
   void setName(const std::string &string) { this->processName = string; }
+  void setLauncher(ProcessLauncher newLauncher) {
+    this->launcher = newLauncher;
+  }
+  void setCpuPlacement(const CpuPlacementSlot &slot) {
+    this->cpuPlacement = slot;
+  }
 
   // Getters
   std::vector<uint64_t> getMeasurements(size_t expectedCount);
   const std::string &getName() const { return this->processName; }
+  ProcessLauncher getLauncher() const { return this->launcher; }
+  const CpuPlacementSlot &getCpuPlacement() const {
+    return this->cpuPlacement;
+  }
 
   // OS-specific methods
   void run();
   void waitForFinish();
+  bool tryWaitForFinish();
+  void terminate(TestResult result, const std::string &reason);
+  bool isTerminated();
   TestResult getResult();
+  const std::string &getFailureReason();
   const std::string &getMeasurements();
   const std::string &getStdout();
   void synchronizationSignal();
   void synchronizationWait();
 
 private:
+  friend class ProcessGroup;
   void freeOsSpecificData();
 
   std::string exeName;
@@ -48,4 +65,6 @@ private:
   std::vector<int> handlesForInheritance;
   void *osSpecificData = nullptr;
   std::string processName = "";
+  ProcessLauncher launcher = ProcessLauncher::Fork;
+  CpuPlacementSlot cpuPlacement = {};
 };
@@ -7,14 +7,21 @@
 
 #include "process_group.h"
 
+#include "framework/configuration.h"
+#include "framework/utility/cpu_placement.h"
 #include "framework/utility/error.h"
 #include "framework/utility/statistics.h"
 #include "framework/utility/string_utils.h"
 
+#include <algorithm>
+
 ProcessGroup::ProcessGroup(const std::string &binaryName, size_t count)
-    : binaryName(binaryName) {
+    : binaryName(binaryName),
+      timeout(std::chrono::seconds(
+          static_cast<size_t>(Configuration::get().processTimeout))) {
   for (auto processIndex = 0u; processIndex < count; processIndex++) {
     processes.emplace_back(binaryName);
+    processes.back().setCpuPlacement(CpuPlacement::getSlot(processIndex));
   }
 }
 
@@ -32,38 +39,138 @@ void ProcessGroup::addEnvVariableAll(const std::string &key,
   }
 }
 
-void ProcessGroup::runAll() {
+void ProcessGroup::setLauncherAll(ProcessLauncher launcher) {
   for (Process &process : processes) {
-    process.run();
+    process.setLauncher(launcher);
+  }
+}
+
+void ProcessGroup::runAll() {
+  this->readiness = std::make_unique<ProcessReadiness>(processes.size());
+  for (auto processIndex = 0u; processIndex < processes.size();
+       processIndex++) {
+    Process &process = processes[processIndex];
+    process.addArgument("readinessHandle",
+                        std::to_string(readiness->getHandle()));
+    process.addArgument("readinessIndex", std::to_string(processIndex));
+    process.addHandleForInheritance(static_cast<int>(readiness->getHandle()));
   }
+
+  this->launchStart = std::chrono::steady_clock::now();
+  this->deadline = launchStart + this->timeout;
+  launchAll();
+  this->launchTime = std::chrono::steady_clock::now() - launchStart;
 }
 
-void ProcessGroup::synchronizeAll(size_t iterationsCount) {
-  for (auto iteration = 0u; iteration < iterationsCount; iteration++) {
-    for (Process &process : processes) {
-      process.synchronizationWait();
+TestResult ProcessGroup::getResultAll() {
+  // Processes terminated by the group only report consequences of a failure of
+  // another process, so the failure which caused them takes precedence.
+  size_t failedIndex = processes.size();
+  for (auto processIndex = 0u; processIndex < processes.size();
+       processIndex++) {
+    Process &process = processes[processIndex];
+    if (process.getResult() == TestResult::Success) {
+      continue;
     }
+    if (failedIndex == processes.size() ||
+        (processes[failedIndex].isTerminated() && !process.isTerminated())) {
+      failedIndex = processIndex;
+    }
+  }
 
-    for (Process &process : processes) {
-      process.synchronizationSignal();
+  if (failedIndex == processes.size()) {
+    if (!failureReason.empty()) {
+      printMessageLine("ERROR", failureReason);
+      return TestResult::Error;
     }
+    return TestResult::Success;
   }
+
+  Process &failedProcess = processes[failedIndex];
+  if (!failedProcess.getFailureReason().empty()) {
+    printMessageLine("ERROR", describeProcess(failedIndex), " ",
+                     failedProcess.getFailureReason());
+  }
+  return failedProcess.getResult();
 }
 
-void ProcessGroup::waitForFinishAll() {
-  for (Process &process : processes) {
-    process.waitForFinish();
+void ProcessGroup::waitForReadyAll() {
+  // Children, which exit before reporting, are detected by polling, because
+  // the counter is the only thing being waited on
+  constexpr static std::chrono::milliseconds exitPollingPeriod{10};
+
+  while (!aborted) {
+    const size_t readyCount = readiness->getReadyCount();
+    if (readyCount == processes.size()) {
+      return;
+    }
+
+    for (auto processIndex = 0u; processIndex < processes.size();
+         processIndex++) {
+      if (!readiness->isReady(processIndex) &&
+          processes[processIndex].tryWaitForFinish()) {
+        // The process may have exited with success, e.g. when it is not a
+        // workload at all, so the failure is recorded for the whole group
+        this->failureReason =
+            describeProcess(processIndex) + " exited before reporting readiness";
+        terminateAll(TestResult::Error,
+                     "terminated after " + describeProcess(processIndex) +
+                         " exited before reporting readiness",
+                     &processes[processIndex]);
+        return;
+      }
+    }
+
+    auto waitTime = exitPollingPeriod;
+    if (timeout.count() != 0) {
+      const auto remaining =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              deadline - std::chrono::steady_clock::now());
+      if (remaining.count() <= 0) {
+        terminateAll(TestResult::ChildProcessTimeout,
+                     "did not report readiness before --processTimeout "
+                     "elapsed",
+                     nullptr);
+        return;
+      }
+      waitTime = std::min(waitTime, remaining);
+    }
+    readiness->waitForChange(readyCount, waitTime);
   }
 }
 
-TestResult ProcessGroup::getResultAll() {
+std::chrono::nanoseconds ProcessGroup::getTimeToReady(size_t index) const {
+  FATAL_ERROR_IF(index >= processes.size(), "Invalid process index");
+  FATAL_ERROR_IF(readiness == nullptr, "Processes were not launched");
+  return readiness->getReadyTime(index) - launchStart;
+}
+
+std::chrono::nanoseconds ProcessGroup::getTimeToReadyAll() const {
+  std::chrono::nanoseconds slowest{};
+  for (auto processIndex = 0u; processIndex < processes.size();
+       processIndex++) {
+    slowest = std::max(slowest, getTimeToReady(processIndex));
+  }
+  return slowest;
+}
+
+void ProcessGroup::terminateAll(TestResult result, const std::string &reason,
+                                const Process *excludedProcess) {
+  this->aborted = true;
   for (Process &process : processes) {
-    const auto result = process.getResult();
-    if (result != TestResult::Success) {
-      return result;
+    if (&process != excludedProcess) {
+      process.terminate(result, reason);
     }
   }
-  return TestResult::Success;
+}
+
+std::string ProcessGroup::describeProcess(size_t index) {
+  std::string description =
+      "child process " + binaryName + " #" + std::to_string(index);
+  if (!processes[index].getName().empty()) {
+    description += " (" + processes[index].getName() + ")";
+  }
+  return description;
 }
 
 void ProcessGroup::pushMeasurementsToStatistics(
@@ -76,6 +183,12 @@ void ProcessGroup::pushMeasurementsToStatistics(
     const auto measurementsFromProcesses =
         process.getMeasurements(expectedCount);
 
+    // Record host placement of the process along with its measurements
+    std::string description = process.getName();
+    if (!process.getCpuPlacement().isEmpty()) {
+      description += " [" + process.getCpuPlacement().toString() + "]";
+    }
+
     for (auto measurementIndex = 0u;
          measurementIndex < measurementsFromProcesses.size();
          measurementIndex++) {
@@ -83,7 +196,7 @@ void ProcessGroup::pushMeasurementsToStatistics(
 
       if (pushIndividualProcessesMeasurements) {
         statistics.pushValue(std::chrono::nanoseconds(measurement), unit, type,
-                             process.getName());
+                             description);
       }
 
       if (pushAveragedMeasurements) {
@@ -101,6 +214,21 @@ void ProcessGroup::pushMeasurementsToStatistics(
   }
 }
 
+void ProcessGroup::pushReadinessToStatistics(
+    Statistics &statistics, MeasurementUnit unit, MeasurementType type,
+    bool pushIndividualProcessesMeasurements) {
+  statistics.pushSetupValue(getLaunchTime(), unit, type, "launch");
+  statistics.pushSetupValue(getTimeToReadyAll(), unit, type, "ready");
+
+  if (pushIndividualProcessesMeasurements) {
+    for (auto processIndex = 0u; processIndex < processes.size();
+         processIndex++) {
+      statistics.pushSetupValue(getTimeToReady(processIndex), unit, type,
+                                processes[processIndex].getName() + " ready");
+    }
+  }
+}
+
 Process &ProcessGroup::operator[](size_t index) {
   FATAL_ERROR_IF(index >= processes.size(), "Invalid process index");
   return processes[index];
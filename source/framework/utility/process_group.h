@@ -10,7 +10,10 @@
 #include "framework/enum/measurement_type.h"
 #include "framework/enum/measurement_unit.h"
 #include "framework/utility/process.h"
+#include "framework/utility/process_readiness.h"
 
+#include <chrono>
+#include <memory>
 #include <string>
 
 class Statistics;
@@ -19,13 +22,35 @@ class ProcessGroup {
 public:
   ProcessGroup(const std::string &binaryName, size_t count);
 
+  // Time after runAll(), in which all processes have to finish. Zero means
+  // no limit. Defaults to --processTimeout.
+  void setTimeout(std::chrono::milliseconds newTimeout) {
+    this->timeout = newTimeout;
+  }
+
   // Applying same operation for all processes
   void addArgumentAll(const std::string &key, const std::string &value);
   void addEnvVariableAll(const std::string &key, const std::string &value);
+  void setLauncherAll(ProcessLauncher launcher);
   void runAll();
+  TestResult getResultAll();
+
+  // Waits until all processes report that they have started, without
+  // consuming any synchronization. A process exiting before that is handled
+  // the same way as a crash.
+  void waitForReadyAll();
+
+  // OS-specific methods. Processes, which crash or exceed the timeout, do not
+  // stop the benchmark. Remaining processes are terminated instead and the
+  // failure is returned by getResultAll().
   void synchronizeAll(size_t iterationsCount);
   void waitForFinishAll();
-  TestResult getResultAll();
+
+  // Launch metrics. Time-to-ready is counted from the start of runAll() and
+  // is available after waitForReadyAll().
+  std::chrono::nanoseconds getLaunchTime() const { return launchTime; }
+  std::chrono::nanoseconds getTimeToReady(size_t index) const;
+  std::chrono::nanoseconds getTimeToReadyAll() const;
 
   // Operations involving all processes
   void pushMeasurementsToStatistics(size_t expectedCount,
@@ -33,12 +58,28 @@ public:
                                     MeasurementUnit unit, MeasurementType type,
                                     bool pushIndividualProcessesMeasurements,
                                     bool pushAveragedMeasurements);
+  void pushReadinessToStatistics(Statistics &statistics, MeasurementUnit unit,
+                                 MeasurementType type,
+                                 bool pushIndividualProcessesMeasurements);
 
   // Container-like methods
   Process &operator[](size_t index);
   size_t size() const;
 
 private:
+  // OS-specific method. Creates all processes, possibly concurrently.
+  void launchAll();
+  void terminateAll(TestResult result, const std::string &reason,
+                    const Process *excludedProcess);
+  std::string describeProcess(size_t index);
+
   const std::string binaryName;
   std::vector<Process> processes = {};
+  std::chrono::milliseconds timeout = {};
+  std::chrono::steady_clock::time_point launchStart = {};
+  std::chrono::steady_clock::time_point deadline = {};
+  std::chrono::nanoseconds launchTime = {};
+  std::unique_ptr<ProcessReadiness> readiness = {};
+  bool aborted = false;
+  std::string failureReason = {};
 };
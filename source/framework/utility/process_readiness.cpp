@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "process_readiness.h"
+
+#include "framework/utility/error.h"
+
+#include <algorithm>
+#include <cstddef>
+
+size_t ProcessReadiness::getBlockSize(size_t processesCount) {
+  return offsetof(Block, readyTimesNs) +
+         std::max<size_t>(processesCount, 1) * sizeof(std::atomic<int64_t>);
+}
+
+std::atomic<int64_t> &
+ProcessReadiness::getReadyTimeNs(size_t processIndex) const {
+  FATAL_ERROR_IF(processIndex >= block->processesCount,
+                 "Invalid process index for readiness");
+  return block->readyTimesNs[processIndex];
+}
+
+size_t ProcessReadiness::getProcessesCount() const {
+  return block->processesCount;
+}
+
+size_t ProcessReadiness::getReadyCount() const {
+  return block->readyCount.load(std::memory_order_acquire);
+}
+
+bool ProcessReadiness::isReady(size_t processIndex) const {
+  return getReadyTimeNs(processIndex).load(std::memory_order_acquire) != 0;
+}
+
+ProcessReadiness::Clock::time_point
+ProcessReadiness::getReadyTime(size_t processIndex) const {
+  const int64_t readyTimeNs =
+      getReadyTimeNs(processIndex).load(std::memory_order_acquire);
+  FATAL_ERROR_IF(readyTimeNs == 0, "Process has not reported readiness");
+  return Clock::time_point{std::chrono::duration_cast<Clock::duration>(
+      std::chrono::nanoseconds(readyTimeNs))};
+}
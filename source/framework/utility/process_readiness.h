@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Shared memory, in which child processes of a ProcessGroup report that they
+// have started. The parent waits on a single counter instead of using the
+// first synchronization as a readiness barrier, and every child stores the
+// moment it became ready, so time-to-ready is known for each of them.
+//
+// The block is created by the parent and its handle is passed to the children
+// with --readinessHandle and --readinessIndex arguments.
+class ProcessReadiness {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  // OS-specific methods
+  explicit ProcessReadiness(size_t processesCount);
+  explicit ProcessReadiness(int64_t inheritedHandle);
+  ~ProcessReadiness() noexcept(false);
+  int64_t getHandle() const { return handle; }
+  void reportReady(size_t processIndex);
+  void waitForChange(size_t observedReadyCount,
+                     std::chrono::milliseconds timeout) const;
+
+  ProcessReadiness(const ProcessReadiness &) = delete;
+  ProcessReadiness &operator=(const ProcessReadiness &) = delete;
+
+  size_t getProcessesCount() const;
+  size_t getReadyCount() const;
+  bool isReady(size_t processIndex) const;
+  Clock::time_point getReadyTime(size_t processIndex) const;
+
+private:
+  // Steady clock is system-wide on supported platforms, so timestamps taken
+  // in different processes can be compared. Zero means not ready yet.
+  struct Block {
+    std::atomic<uint32_t> readyCount;
+    uint32_t processesCount;
+    std::atomic<int64_t> readyTimesNs[1];
+  };
+
+  static size_t getBlockSize(size_t processesCount);
+  std::atomic<int64_t> &getReadyTimeNs(size_t processIndex) const;
+
+  int64_t handle = -1;
+  size_t blockSize = 0;
+  Block *block = nullptr;
+};
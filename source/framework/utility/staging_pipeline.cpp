@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "staging_pipeline.h"
+
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/error.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define STAGING_PIPELINE_STREAM_STORES
+#endif
+
+constexpr static size_t cacheLineSize = 64;
+
+// Staging buffers are written once and read by the copy engine only, so
+// streaming stores keep them from evicting useful data out of the caches
+static void copyNonTemporal(uint8_t *dst, const uint8_t *src, size_t size) {
+#if defined(STAGING_PIPELINE_STREAM_STORES)
+  const size_t head = std::min(
+      alignUp(reinterpret_cast<uintptr_t>(dst), sizeof(__m128i)) -
+          reinterpret_cast<uintptr_t>(dst),
+      size);
+  std::memcpy(dst, src, head);
+  size_t position = head;
+  for (; position + sizeof(__m128i) <= size; position += sizeof(__m128i)) {
+    const __m128i value = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(src + position));
+    _mm_stream_si128(reinterpret_cast<__m128i *>(dst + position), value);
+  }
+  std::memcpy(dst + position, src + position, size - position);
+  _mm_sfence();
+#else
+  std::memcpy(dst, src, size);
+#endif
+}
+
+StagingPipeline::StagingPipeline(CopyEngine &engine, ThreadTeam &hostThreads,
+                                 const std::vector<void *> &stagingBuffers,
+                                 bool nonTemporal)
+    : engine(engine), hostThreads(hostThreads), stagingBuffers(stagingBuffers),
+      nonTemporal(nonTemporal) {
+  FATAL_ERROR_IF(stagingBuffers.empty(), "No staging buffers for pipeline");
+}
+
+void StagingPipeline::transfer(Direction direction, void *hostBuffer,
+                               size_t size, size_t chunkSize) {
+  FATAL_ERROR_IF(chunkSize == 0, "Invalid chunk size for staging pipeline");
+  uint8_t *host = static_cast<uint8_t *>(hostBuffer);
+  const size_t chunksCount = (size + chunkSize - 1) / chunkSize;
+  const size_t depth = stagingBuffers.size();
+  const auto getChunkBytes = [&](size_t chunkIndex) {
+    return std::min(chunkSize, size - chunkIndex * chunkSize);
+  };
+
+  if (direction == Direction::ToDevice) {
+    // A staging buffer is refilled after the engine has drained it
+    for (size_t chunk = 0; chunk < chunksCount; chunk++) {
+      const size_t staging = chunk % depth;
+      if (chunk >= depth) {
+        engine.wait(staging);
+      }
+      copyOnHost(stagingBuffers[staging], host + chunk * chunkSize,
+                 getChunkBytes(chunk));
+      engine.submit(direction, staging, chunk * chunkSize,
+                    getChunkBytes(chunk));
+    }
+    for (size_t staging = 0; staging < std::min(depth, chunksCount);
+         staging++) {
+      engine.wait(staging);
+    }
+    return;
+  }
+
+  // All staging buffers are filled up front and each one is refilled with
+  // a further chunk as soon as the host has drained it
+  for (size_t chunk = 0; chunk < std::min(depth, chunksCount); chunk++) {
+    engine.submit(direction, chunk, chunk * chunkSize, getChunkBytes(chunk));
+  }
+  for (size_t chunk = 0; chunk < chunksCount; chunk++) {
+    const size_t staging = chunk % depth;
+    engine.wait(staging);
+    copyOnHost(host + chunk * chunkSize, stagingBuffers[staging],
+               getChunkBytes(chunk));
+    const size_t nextChunk = chunk + depth;
+    if (nextChunk < chunksCount) {
+      engine.submit(direction, staging, nextChunk * chunkSize,
+                    getChunkBytes(nextChunk));
+    }
+  }
+}
+
+void StagingPipeline::copyOnHost(void *dst, const void *src, size_t size) {
+  hostThreads.run([&](size_t threadIndex, size_t threadsCount) {
+    const size_t partSize =
+        alignUp((size + threadsCount - 1) / threadsCount, cacheLineSize);
+    const size_t begin = std::min(threadIndex * partSize, size);
+    const size_t end = std::min(begin + partSize, size);
+    uint8_t *partDst = static_cast<uint8_t *>(dst) + begin;
+    const uint8_t *partSrc = static_cast<const uint8_t *>(src) + begin;
+    if (nonTemporal) {
+      copyNonTemporal(partDst, partSrc, end - begin);
+    } else {
+      std::memcpy(partDst, partSrc, end - begin);
+    }
+  });
+}
+
+ThreadCopyEngine::ThreadCopyEngine(void *deviceBuffer,
+                                   const std::vector<void *> &stagingBuffers)
+    : deviceBuffer(static_cast<uint8_t *>(deviceBuffer)),
+      stagingBuffers(stagingBuffers),
+      inFlightCounts(stagingBuffers.size(), 0),
+      worker(&ThreadCopyEngine::workerLoop, this) {}
+
+ThreadCopyEngine::~ThreadCopyEngine() {
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    terminating = true;
+  }
+  condition.notify_all();
+  worker.join();
+}
+
+void ThreadCopyEngine::submit(StagingPipeline::Direction direction,
+                              size_t stagingIndex, size_t offset,
+                              size_t size) {
+  Copy copy{deviceBuffer + offset, stagingBuffers[stagingIndex], size,
+            stagingIndex};
+  if (direction == StagingPipeline::Direction::FromDevice) {
+    copy.dst = stagingBuffers[stagingIndex];
+    copy.src = deviceBuffer + offset;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    pendingCopies.push_back(copy);
+    inFlightCounts[stagingIndex]++;
+  }
+  condition.notify_all();
+}
+
+void ThreadCopyEngine::wait(size_t stagingIndex) {
+  std::unique_lock<std::mutex> lock{mutex};
+  condition.wait(lock, [&] { return inFlightCounts[stagingIndex] == 0; });
+}
+
+void ThreadCopyEngine::workerLoop() {
+  std::unique_lock<std::mutex> lock{mutex};
+  while (true) {
+    condition.wait(lock, [&] { return terminating || !pendingCopies.empty(); });
+    if (pendingCopies.empty()) {
+      return;
+    }
+
+    const Copy copy = pendingCopies.front();
+    pendingCopies.pop_front();
+    lock.unlock();
+    std::memcpy(copy.dst, copy.src, copy.size);
+    lock.lock();
+
+    inFlightCounts[copy.stagingIndex]--;
+    condition.notify_all();
+  }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/utility/thread_team.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Transfers a host buffer to or from memory, which is not accessed by the host
+// directly, in chunks going through a ring of staging buffers. While the copy
+// engine works on one chunk, host threads copy the next one, so with two or
+// more staging buffers both copies overlap.
+class StagingPipeline {
+public:
+  enum class Direction { ToDevice, FromDevice };
+
+  // Copies chunks between staging buffers and the memory on the other side of
+  // the pipeline. Offsets are relative to the beginning of that memory.
+  class CopyEngine {
+  public:
+    virtual ~CopyEngine() = default;
+
+    // Starts copying the chunk without waiting for it to finish
+    virtual void submit(Direction direction, size_t stagingIndex,
+                        size_t offset, size_t size) = 0;
+
+    // Waits for the last copy submitted for the staging buffer
+    virtual void wait(size_t stagingIndex) = 0;
+  };
+
+  // Host copies are split between all threads of the team
+  StagingPipeline(CopyEngine &engine, ThreadTeam &hostThreads,
+                  const std::vector<void *> &stagingBuffers, bool nonTemporal);
+
+  void transfer(Direction direction, void *hostBuffer, size_t size,
+                size_t chunkSize);
+
+private:
+  void copyOnHost(void *dst, const void *src, size_t size);
+
+  CopyEngine &engine;
+  ThreadTeam &hostThreads;
+  const std::vector<void *> stagingBuffers;
+  const bool nonTemporal;
+};
+
+// Copy engine backed by a single host thread doing memcpy. It stands in for
+// a device copy engine, so the pipeline can be exercised on any machine.
+class ThreadCopyEngine : public StagingPipeline::CopyEngine {
+public:
+  ThreadCopyEngine(void *deviceBuffer,
+                   const std::vector<void *> &stagingBuffers);
+  ~ThreadCopyEngine() override;
+
+  ThreadCopyEngine(const ThreadCopyEngine &) = delete;
+  ThreadCopyEngine &operator=(const ThreadCopyEngine &) = delete;
+
+  void submit(StagingPipeline::Direction direction, size_t stagingIndex,
+              size_t offset, size_t size) override;
+  void wait(size_t stagingIndex) override;
+
+private:
+  struct Copy {
+    void *dst;
+    const void *src;
+    size_t size;
+    size_t stagingIndex;
+  };
+
+  void workerLoop();
+
+  uint8_t *const deviceBuffer;
+  const std::vector<void *> stagingBuffers;
+
+  std::mutex mutex = {};
+  std::condition_variable condition = {};
+  std::deque<Copy> pendingCopies = {};
+  std::vector<size_t> inFlightCounts;
+  bool terminating = false;
+  std::thread worker;
+};
@@ -36,6 +36,12 @@ public:
                           const std::string &description = "") = 0;
   virtual void pushUnitAndType(MeasurementUnit unit, MeasurementType type) = 0;
 
+  // Values measured once per test instead of once per iteration, e.g. the
+  // cost of launching child processes. They have to be labeled.
+  virtual void pushSetupValue(Clock::duration time, MeasurementUnit unit,
+                              MeasurementType type,
+                              const std::string &description) = 0;
+
   virtual bool isEmpty() const = 0;
   virtual bool isFull() const = 0;
 
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "system_noise.h"
+
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+using namespace std::chrono_literals;
+
+// Reading the clock takes tens of nanoseconds, so longer gaps between
+// consecutive reads mean the thread was interrupted
+constexpr static std::chrono::nanoseconds minInterruption = 1us;
+constexpr static std::chrono::nanoseconds bucketLimits[] = {10us, 100us, 1ms};
+static_assert(std::size(bucketLimits) + 1 ==
+              SystemNoise::JitterProbe::bucketsCount);
+
+size_t SystemNoise::JitterProbe::getInterruptionsCount() const {
+  size_t count = 0;
+  for (size_t bucket : histogram) {
+    count += bucket;
+  }
+  return count;
+}
+
+double SystemNoise::JitterProbe::getInterruptedPercentage() const {
+  if (duration.count() == 0) {
+    return 0;
+  }
+  return 100.0 * interruptedTime.count() / duration.count();
+}
+
+bool SystemNoise::JitterProbe::isNoisy() const {
+  return getInterruptedPercentage() > 1.0 || longestInterruption > 1ms;
+}
+
+std::string SystemNoise::JitterProbe::toString() const {
+  const auto toMicroseconds = [](std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::micro>(time).count();
+  };
+  std::ostringstream result{};
+  result << std::fixed << std::setprecision(2) << getInterruptedPercentage()
+         << "% of " << std::setprecision(0)
+         << std::chrono::duration<double, std::milli>(duration).count()
+         << " ms lost in " << getInterruptionsCount()
+         << " interruptions, longest " << toMicroseconds(longestInterruption)
+         << " us (1-10us: " << histogram[0] << ", 10-100us: " << histogram[1]
+         << ", 100us-1ms: " << histogram[2] << ", >1ms: " << histogram[3]
+         << ")";
+  return result.str();
+}
+
+SystemNoise::JitterProbe
+SystemNoise::measureJitter(std::chrono::milliseconds duration) {
+  using Clock = std::chrono::steady_clock;
+  JitterProbe probe{};
+  const Clock::time_point start = Clock::now();
+  const Clock::time_point end = start + duration;
+  Clock::time_point previous = start;
+  for (Clock::time_point now = start; now < end; now = Clock::now()) {
+    const auto gap = now - previous;
+    previous = now;
+    if (gap < minInterruption) {
+      continue;
+    }
+
+    size_t bucket = 0;
+    while (bucket < std::size(bucketLimits) && gap >= bucketLimits[bucket]) {
+      bucket++;
+    }
+    probe.histogram[bucket]++;
+    probe.interruptedTime += gap;
+    if (gap > probe.longestInterruption) {
+      probe.longestInterruption = gap;
+    }
+  }
+  probe.duration = previous - start;
+  return probe;
+}
+
+std::string SystemNoise::toString(const std::vector<Finding> &findings) {
+  std::string result{};
+  for (const Finding &finding : findings) {
+    if (!result.empty()) {
+      result += ", ";
+    }
+    result += finding.name + "=" + finding.value;
+    if (finding.noisy) {
+      result += " (noisy)";
+    }
+  }
+  return result;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Preflight audit of the host selected with --preflight. Settings like CPU
+// frequency governor, turbo or background load make results differ between
+// runs and machines, so they are printed along with the results. Noise of the
+// OS is measured by a thread spinning on a clock, which notices interruptions
+// as gaps between consecutive reads.
+struct SystemNoise {
+  struct Finding {
+    std::string name = {};
+    std::string value = {};
+    bool noisy = false; // setting is known to make results less stable
+  };
+
+  struct JitterProbe {
+    // Gaps of 1-10us, 10-100us, 100us-1ms and over 1ms
+    constexpr static size_t bucketsCount = 4;
+    std::array<size_t, bucketsCount> histogram = {};
+    std::chrono::nanoseconds duration = {};
+    std::chrono::nanoseconds interruptedTime = {};
+    std::chrono::nanoseconds longestInterruption = {};
+
+    size_t getInterruptionsCount() const;
+    double getInterruptedPercentage() const;
+    bool isNoisy() const;
+    std::string toString() const;
+  };
+
+  // OS-specific implementation. Settings, which cannot be queried, are
+  // skipped.
+  static std::vector<Finding> auditSettings();
+
+  static JitterProbe measureJitter(std::chrono::milliseconds duration);
+
+  // Isolated CPUs, if there are any. Otherwise CPUs, which handled fewer
+  // interrupts than the median. Empty if they cannot be queried.
+  static std::vector<size_t> getQuietCpus(); // OS-specific implementation
+
+  // Findings in a single line, e.g. "governor=performance, turbo=off"
+  static std::string toString(const std::vector<Finding> &findings);
+};
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "thread_team.h"
+
+#include <algorithm>
+
+static size_t resolveThreadsCount(size_t threadsCount) {
+  if (threadsCount == 0) {
+    threadsCount = std::thread::hardware_concurrency();
+  }
+  return std::max<size_t>(threadsCount, 1);
+}
+
+ThreadTeam::ThreadTeam(size_t threadsCount)
+    : threadsCount(resolveThreadsCount(threadsCount)),
+      callerPlacement(CpuPlacement::getSlot(0)) {
+  workers.reserve(this->threadsCount - 1);
+  for (size_t threadIndex = 1; threadIndex < this->threadsCount;
+       threadIndex++) {
+    workers.emplace_back(&ThreadTeam::workerLoop, this, threadIndex);
+  }
+}
+
+ThreadTeam::~ThreadTeam() {
+  terminating.store(true, std::memory_order_release);
+  generation.fetch_add(1, std::memory_order_acq_rel);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+void ThreadTeam::run(const Job &job) {
+  currentJob = &job;
+  runningCount.store(threadsCount - 1, std::memory_order_relaxed);
+  generation.fetch_add(1, std::memory_order_acq_rel);
+
+  runJob(0);
+  while (runningCount.load(std::memory_order_acquire) != 0) {
+    std::this_thread::yield();
+  }
+  currentJob = nullptr;
+
+  if (exception) {
+    std::exception_ptr firstException = exception;
+    exception = nullptr;
+    std::rethrow_exception(firstException);
+  }
+}
+
+void ThreadTeam::workerLoop(size_t threadIndex) {
+  try {
+    CpuPlacement::pinCurrentThread(CpuPlacement::getSlot(threadIndex));
+  } catch (...) {
+    // Placement errors are rethrown by the first run, which cannot finish
+    // before this thread has started waiting for it
+    std::lock_guard<std::mutex> lock{exceptionMutex};
+    exception = std::current_exception();
+  }
+
+  uint64_t observedGeneration = 0;
+  while (true) {
+    uint64_t currentGeneration;
+    while ((currentGeneration = generation.load(std::memory_order_acquire)) ==
+           observedGeneration) {
+      std::this_thread::yield();
+    }
+    observedGeneration = currentGeneration;
+    if (terminating.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    runJob(threadIndex);
+    runningCount.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+void ThreadTeam::runJob(size_t threadIndex) {
+  try {
+    (*currentJob)(threadIndex, threadsCount);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock{exceptionMutex};
+    if (!exception) {
+      exception = std::current_exception();
+    }
+  }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "framework/utility/cpu_placement.h"
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Persistent team of host threads running the same job, in the manner of an
+// OpenMP parallel region. Threads are created and placed according to
+// --cpuPlacement once, so repeated runs measure only the job itself. The
+// calling thread takes part in every run as the thread with index 0, and
+// workers wait for the next run by spinning, so waking them up is cheap.
+class ThreadTeam {
+public:
+  using Job = std::function<void(size_t threadIndex, size_t threadsCount)>;
+
+  // Zero means one thread per logical core
+  explicit ThreadTeam(size_t threadsCount);
+  ~ThreadTeam();
+
+  ThreadTeam(const ThreadTeam &) = delete;
+  ThreadTeam &operator=(const ThreadTeam &) = delete;
+
+  size_t getThreadsCount() const { return threadsCount; }
+
+  // Returns after all threads have finished the job. The first exception
+  // thrown by any of them is rethrown.
+  void run(const Job &job);
+
+private:
+  void workerLoop(size_t threadIndex);
+  void runJob(size_t threadIndex);
+
+  const size_t threadsCount;
+  ScopedCpuPlacement callerPlacement;
+  std::vector<std::thread> workers = {};
+
+  const Job *currentJob = nullptr;
+  std::atomic<uint64_t> generation{0};
+  std::atomic<size_t> runningCount{0};
+  std::atomic<bool> terminating{false};
+
+  std::mutex exceptionMutex = {};
+  std::exception_ptr exception = nullptr;
+};
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/checkpoint_journal.h"
+#include "framework/utility/error.h"
+#include "framework/utility/windows/windows.h"
+
+void CheckpointJournal::openFile() {
+  HANDLE file = CreateFileA(filePath.c_str(), FILE_APPEND_DATA,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                            OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+  FATAL_ERROR_IF(file == INVALID_HANDLE_VALUE, "Cannot open journal file \"",
+                 filePath, "\"");
+  fileHandle = reinterpret_cast<int64_t>(file);
+}
+
+void CheckpointJournal::writeToFile(const std::string &data) {
+  HANDLE file = reinterpret_cast<HANDLE>(fileHandle);
+  DWORD written = 0;
+  const DWORD size = static_cast<DWORD>(data.size());
+  const BOOL success = WriteFile(file, data.c_str(), size, &written, NULL);
+  FATAL_ERROR_IF(!success || written != size,
+                 "Cannot write to journal file \"", filePath, "\"");
+  FlushFileBuffers(file);
+}
+
+void CheckpointJournal::closeFile() {
+  CloseHandle(reinterpret_cast<HANDLE>(fileHandle));
+  fileHandle = -1;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_placement.h"
+#include "framework/utility/error.h"
+#include "framework/utility/windows/windows.h"
+
+static DWORD_PTR createAffinityMask(const std::vector<size_t> &cpus) {
+  DWORD_PTR mask = 0;
+  for (size_t cpu : cpus) {
+    FATAL_ERROR_IF(cpu >= sizeof(DWORD_PTR) * 8,
+                   "CPU groups are not supported");
+    mask |= static_cast<DWORD_PTR>(1) << cpu;
+  }
+  return mask;
+}
+
+void CpuPlacement::pinCurrentThread(const CpuPlacementSlot &slot) {
+  // Only CPU affinity is applied on Windows, NUMA nodes are ignored
+  if (slot.isEmpty()) {
+    return;
+  }
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      SetThreadAffinityMask(GetCurrentThread(), createAffinityMask(slot.cpus)),
+      "SetThreadAffinityMask failed");
+}
+
+void CpuPlacement::bindMemory([[maybe_unused]] void *address,
+                              [[maybe_unused]] size_t size,
+                              [[maybe_unused]] const CpuPlacementSlot &slot) {}
+
+ScopedCpuPlacement::ScopedCpuPlacement(const CpuPlacementSlot &slot) {
+  if (slot.isEmpty()) {
+    return;
+  }
+
+  const DWORD_PTR previousMask = SetThreadAffinityMask(
+      GetCurrentThread(), createAffinityMask(slot.cpus));
+  FATAL_ERROR_IF_SYS_CALL_FAILED(previousMask, "SetThreadAffinityMask failed");
+  for (size_t cpu = 0u; cpu < sizeof(DWORD_PTR) * 8; cpu++) {
+    if (previousMask & (static_cast<DWORD_PTR>(1) << cpu)) {
+      previousCpus.push_back(cpu);
+    }
+  }
+  active = true;
+}
+
+ScopedCpuPlacement::~ScopedCpuPlacement() noexcept(false) {
+  if (!active) {
+    return;
+  }
+  SetThreadAffinityMask(GetCurrentThread(), createAffinityMask(previousCpus));
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/cpu_topology.h"
+
+#include <thread>
+
+CpuTopology CpuTopology::discover() {
+  // Topology is not parsed on Windows. Every logical CPU is treated as
+  // a separate core of a single NUMA node.
+  CpuTopology topology{};
+  topology.numaNodes.push_back(0);
+  for (size_t cpu = 0u; cpu < std::thread::hardware_concurrency(); cpu++) {
+    topology.cpus.push_back(LogicalCpu{cpu, cpu, 0, 0});
+  }
+  return topology;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/file_helper.h"
+#include "framework/utility/windows/windows.h"
+
+FileHelper::MappedFile::MappedFile(const std::string &filePath) {
+  HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return;
+  }
+
+  // The view stays valid after closing handles of the file and the mapping
+  LARGE_INTEGER fileSize{};
+  if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping != NULL) {
+      const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (view != NULL) {
+        this->data = static_cast<const uint8_t *>(view);
+        this->size = static_cast<size_t>(fileSize.QuadPart);
+      }
+      CloseHandle(mapping);
+    }
+  }
+  CloseHandle(file);
+}
+
+FileHelper::MappedFile::~MappedFile() {
+  if (data != nullptr) {
+    UnmapViewOfFile(data);
+  }
+}
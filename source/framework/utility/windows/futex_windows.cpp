@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/futex.h"
+#include "framework/utility/windows/windows.h"
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex word has to be a plain 32-bit integer");
+
+void Futex::wait(std::atomic<uint32_t> &word, uint32_t expectedValue) {
+  WaitOnAddress(&word, &expectedValue, sizeof(expectedValue), INFINITE);
+}
+
+void Futex::wakeOne(std::atomic<uint32_t> &word) {
+  WakeByAddressSingle(&word);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/error.h"
+#include "framework/utility/host_allocator.h"
+#include "framework/utility/windows/windows.h"
+
+#include <algorithm>
+#include <malloc.h>
+
+static void warnAboutLargePagesFallback() {
+  static bool warned = false;
+  if (!warned) {
+    printMessageLine("WARNING", "Could not allocate large pages, small pages "
+                                "are used instead. Large pages require "
+                                "SeLockMemoryPrivilege");
+    warned = true;
+  }
+}
+
+HostAllocator::Pages HostAllocator::allocatePages(size_t size,
+                                                  size_t alignment,
+                                                  HostAllocationPolicy policy) {
+  Pages pages{};
+
+  // Large pages have a single size, which is used for both HugeTlb policies.
+  // They are aligned to their size by VirtualAlloc.
+  if (policy == HostAllocationPolicy::HugeTlb2M ||
+      policy == HostAllocationPolicy::HugeTlb1G) {
+    const size_t largePageSize = GetLargePageMinimum();
+    if (largePageSize != 0 && alignment <= largePageSize) {
+      pages.size = alignUp(size, largePageSize);
+      pages.base = VirtualAlloc(nullptr, pages.size,
+                                MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                                PAGE_READWRITE);
+    }
+    if (pages.base != nullptr) {
+      pages.buffer = pages.base;
+      pages.policy = HostAllocationPolicy::HugeTlb2M;
+      return pages;
+    }
+    warnAboutLargePagesFallback();
+  }
+
+  // There are no transparent huge pages, so other policies get small pages
+  alignment = std::max(alignment, alignof(std::max_align_t));
+  pages.size = alignUp(size, alignment);
+  pages.base = _aligned_malloc(pages.size, alignment);
+  FATAL_ERROR_IF(pages.base == nullptr, "Host allocation failed");
+  pages.buffer = pages.base;
+  pages.policy = policy == HostAllocationPolicy::Default
+                     ? HostAllocationPolicy::Default
+                     : HostAllocationPolicy::SmallPages;
+  return pages;
+}
+
+void HostAllocator::freePages(const Pages &pages) {
+  if (pages.policy == HostAllocationPolicy::HugeTlb2M) {
+    FATAL_ERROR_IF(VirtualFree(pages.base, 0, MEM_RELEASE) == 0,
+                   "VirtualFree failed");
+    return;
+  }
+  _aligned_free(pages.base);
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/host_cache.h"
+#include "framework/utility/windows/windows.h"
+
+#include <vector>
+
+static std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> getCachesInfo() {
+  DWORD length = 0;
+  GetLogicalProcessorInformation(nullptr, &length);
+  std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(
+      length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+  if (!GetLogicalProcessorInformation(infos.data(), &length)) {
+    return {};
+  }
+  return infos;
+}
+
+size_t HostCache::queryCacheLineSize() {
+  for (const auto &info : getCachesInfo()) {
+    if (info.Relationship == RelationCache && info.Cache.Level == 1) {
+      return info.Cache.LineSize;
+    }
+  }
+  return 0;
+}
+
+size_t HostCache::queryCacheSize(size_t level) {
+  for (const auto &info : getCachesInfo()) {
+    if (info.Relationship == RelationCache && info.Cache.Level == level &&
+        info.Cache.Type != CacheInstruction) {
+      return info.Cache.Size;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2022-2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/process_group.h"
+
+void ProcessGroup::launchAll() {
+  // Process::run() passes environment variables through the environment of
+  // the parent, so processes cannot be created concurrently
+  for (Process &process : processes) {
+    process.run();
+  }
+}
+
+void ProcessGroup::synchronizeAll(size_t iterationsCount) {
+  for (auto iteration = 0u; iteration < iterationsCount; iteration++) {
+    for (Process &process : processes) {
+      process.synchronizationWait();
+    }
+
+    for (Process &process : processes) {
+      process.synchronizationSignal();
+    }
+  }
+}
+
+void ProcessGroup::waitForFinishAll() {
+  for (Process &process : processes) {
+    process.waitForFinish();
+  }
+}
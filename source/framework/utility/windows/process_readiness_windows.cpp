@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/error.h"
+#include "framework/utility/process_readiness.h"
+#include "framework/utility/windows/windows.h"
+
+#include <thread>
+
+ProcessReadiness::ProcessReadiness(size_t processesCount) {
+  // Children are created with inheritance of all inheritable handles, so the
+  // mapping is available in them under the same value
+  SECURITY_ATTRIBUTES securityAttributes{};
+  securityAttributes.nLength = sizeof(securityAttributes);
+  securityAttributes.bInheritHandle = TRUE;
+  securityAttributes.lpSecurityDescriptor = NULL;
+
+  this->blockSize = getBlockSize(processesCount);
+  HANDLE mapping = CreateFileMappingA(
+      INVALID_HANDLE_VALUE, &securityAttributes, PAGE_READWRITE, 0,
+      static_cast<DWORD>(blockSize), NULL);
+  FATAL_ERROR_IF_SYS_CALL_FAILED(mapping, "creating readiness block");
+  this->handle = reinterpret_cast<int64_t>(mapping);
+  this->block = static_cast<Block *>(
+      MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, blockSize));
+  FATAL_ERROR_IF_SYS_CALL_FAILED(block, "mapping readiness block");
+
+  // Pages of a new mapping are zeroed, so all processes start as not ready
+  this->block->processesCount = static_cast<uint32_t>(processesCount);
+}
+
+ProcessReadiness::ProcessReadiness(int64_t inheritedHandle) {
+  this->handle = inheritedHandle;
+  this->block = static_cast<Block *>(
+      MapViewOfFile(reinterpret_cast<HANDLE>(inheritedHandle),
+                    FILE_MAP_ALL_ACCESS, 0, 0, 0));
+  FATAL_ERROR_IF_SYS_CALL_FAILED(block, "mapping readiness block");
+  this->blockSize = getBlockSize(block->processesCount);
+}
+
+ProcessReadiness::~ProcessReadiness() noexcept(false) {
+  if (block != nullptr) {
+    FATAL_ERROR_IF_SYS_CALL_FAILED(UnmapViewOfFile(block),
+                                   "unmapping readiness block");
+  }
+  if (handle != -1) {
+    FATAL_ERROR_IF_SYS_CALL_FAILED(
+        CloseHandle(reinterpret_cast<HANDLE>(handle)),
+        "closing readiness block");
+  }
+}
+
+void ProcessReadiness::reportReady(size_t processIndex) {
+  const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      Clock::now().time_since_epoch());
+  getReadyTimeNs(processIndex).store(now.count(), std::memory_order_release);
+  block->readyCount.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void ProcessReadiness::waitForChange(size_t observedReadyCount,
+                                     std::chrono::milliseconds timeout) const {
+  // There is no cross-process wait on an address, so the counter is polled
+  const auto deadline = Clock::now() + timeout;
+  while (getReadyCount() == observedReadyCount && Clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
@@ -28,7 +28,9 @@ struct ProcessDataWindows {
   // Cached Values
   bool ended = false;
   bool hasResult = false;
+  bool terminated = false;
   TestResult result = TestResult::Error;
+  std::string failureReason = {};
   std::string stdOut = {};
 };
 
@@ -217,6 +219,53 @@ void Process::waitForFinish() {
   processDataWindows->ended = true;
 }
 
+bool Process::tryWaitForFinish() {
+  ProcessDataWindows *processDataWindows =
+      static_cast<ProcessDataWindows *>(this->osSpecificData);
+  if (processDataWindows->ended) {
+    return true;
+  }
+
+  if (WaitForSingleObject(processDataWindows->processInfo.hProcess, 0) !=
+      WAIT_OBJECT_0) {
+    return false;
+  }
+  waitForFinish();
+  return true;
+}
+
+void Process::terminate(TestResult result, const std::string &reason) {
+  ProcessDataWindows *processDataWindows =
+      static_cast<ProcessDataWindows *>(this->osSpecificData);
+
+  // A child, which has already exited, keeps its own result
+  if (tryWaitForFinish()) {
+    return;
+  }
+
+  processDataWindows->terminated = true;
+  processDataWindows->hasResult = true;
+  processDataWindows->result = result;
+  processDataWindows->failureReason = reason;
+  FATAL_ERROR_IF_SYS_CALL_FAILED(
+      TerminateProcess(processDataWindows->processInfo.hProcess,
+                       static_cast<UINT>(result)),
+      "terminating process");
+  waitForFinish();
+}
+
+bool Process::isTerminated() {
+  ProcessDataWindows *processDataWindows =
+      static_cast<ProcessDataWindows *>(this->osSpecificData);
+  return processDataWindows->terminated;
+}
+
+const std::string &Process::getFailureReason() {
+  ProcessDataWindows *processDataWindows =
+      static_cast<ProcessDataWindows *>(this->osSpecificData);
+  return processDataWindows->failureReason;
+}
+
 TestResult Process::getResult() {
   ProcessDataWindows *processDataWindows =
       static_cast<ProcessDataWindows *>(this->osSpecificData);
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/system_noise.h"
+#include "framework/utility/windows/windows.h"
+
+std::vector<SystemNoise::Finding> SystemNoise::auditSettings() {
+  std::vector<Finding> findings{};
+
+  // SMT siblings share execution units and caches of a core
+  DWORD length = 0;
+  GetLogicalProcessorInformation(nullptr, &length);
+  std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(
+      length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+  if (GetLogicalProcessorInformation(infos.data(), &length)) {
+    bool smt = false;
+    for (const auto &info : infos) {
+      smt |= info.Relationship == RelationProcessorCore &&
+             info.ProcessorCore.Flags == LTP_PC_SMT;
+    }
+    findings.push_back({"SMT", smt ? "on" : "off", smt});
+  }
+  return findings;
+}
+
+std::vector<size_t> SystemNoise::getQuietCpus() { return {}; }
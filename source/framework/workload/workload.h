@@ -10,6 +10,7 @@
 #include "framework/configuration.h"
 #include "framework/test_case/test_result.h"
 #include "framework/utility/common_help_message.h"
+#include "framework/utility/process_readiness.h"
 #include "framework/workload/workload.h"
 #include "framework/workload/workload_argument_container.h"
 #include "framework/workload/workload_io.h"
@@ -78,6 +79,11 @@ public:
   }
 
   ProcessResult run(const ArgumentContainerT &arguments) {
+    if (arguments.readinessHandle != -1) {
+      ProcessReadiness readiness{arguments.readinessHandle};
+      readiness.reportReady(static_cast<size_t>(arguments.readinessIndex));
+    }
+
     WorkloadStatistics statistics{arguments.iterations};
     WorkloadSynchronization synchronization{arguments.iterations,
                                             arguments.synchronize};
@@ -16,6 +16,8 @@ struct WorkloadArgumentContainer : ArgumentContainer {
   IntegerArgument synchronizationPipeIn;
   IntegerArgument synchronizationPipeOut;
   IntegerArgument measurementPipe;
+  IntegerArgument readinessHandle;
+  IntegerArgument readinessIndex;
 
   WorkloadArgumentContainer()
       : iterations(*this, "iterations", "Number of iterations to perform"),
@@ -29,7 +31,14 @@ struct WorkloadArgumentContainer : ArgumentContainer {
                                "parent). If 0, stdout is used."),
         measurementPipe(
             *this, "measurementPipe",
-            "Handle for the measurements pipe. If 0, stdout is used") {
+            "Handle for the measurements pipe. If 0, stdout is used"),
+        readinessHandle(*this, "readinessHandle",
+                        "Handle for the shared memory, in which the process "
+                        "reports that it has started. If -1, it is not "
+                        "reported."),
+        readinessIndex(*this, "readinessIndex",
+                       "Index of the process in the readiness shared "
+                       "memory") {
 
     // Default values
     iterations = 10;
@@ -40,5 +49,7 @@ struct WorkloadArgumentContainer : ArgumentContainer {
     synchronizationPipeIn = 0;
     synchronizationPipeOut = 0;
     measurementPipe = 0;
+    readinessHandle = -1;
+    readinessIndex = 0;
   }
 };
@@ -96,6 +96,14 @@ void WorkloadStatistics::pushUnitAndType(
     [[maybe_unused]] MeasurementUnit unit,
     [[maybe_unused]] MeasurementType type) {}
 
+void WorkloadStatistics::pushSetupValue([[maybe_unused]] Clock::duration time,
+                                        [[maybe_unused]] MeasurementUnit unit,
+                                        [[maybe_unused]] MeasurementType type,
+                                        [[maybe_unused]]
+                                        const std::string &description) {
+  FATAL_ERROR("WorkloadStatistics does not support setup values");
+}
+
 bool WorkloadStatistics::isEmpty() const { return samplesCount == 0; }
 
 bool WorkloadStatistics::isFull() const {
@@ -36,6 +36,9 @@ public:
                           MeasurementType type,
                           const std::string &description = "") override;
   void pushUnitAndType(MeasurementUnit unit, MeasurementType type) override;
+  void pushSetupValue(Clock::duration time, MeasurementUnit unit,
+                      MeasurementType type,
+                      const std::string &description) override;
 
   bool isEmpty() const override;
   bool isFull() const override;
@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/configuration.h"
+#include "framework/utility/aligned_allocator.h"
+#include "framework/utility/host_allocator.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/memory_constants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string.h>
+#include <vector>
+
+using namespace MemoryConstants;
+
+enum Kernel : size_t { READ = 0, WRITE, COPY, LATENCY, KERNELS_COUNT };
+const char *kernelNames[KERNELS_COUNT] = {"read", "write", "copy", "latency"};
+const char *kernelUnits[KERNELS_COUNT] = {"GB/s", "GB/s", "GB/s", "ns"};
+
+constexpr size_t defaultMinSize = 4 * kiloByte;
+constexpr size_t defaultMaxSizeWithoutLlc = 256 * megaByte;
+constexpr size_t defaultPointsPerOctave = 4;
+constexpr size_t defaultIterations = 5;
+
+// Each measurement moves at least this many bytes or performs at least this
+// many loads, so timer overhead does not matter for small working sets
+constexpr size_t minimumBytesPerMeasurement = 64 * megaByte;
+constexpr size_t minimumLoadsPerMeasurement = 1024 * 1024;
+
+// A cache boundary is where the cost grows more than 1.5 times over
+// consecutive points, each of which grows by more than 10%
+constexpr double boundaryGrowth = 1.5;
+constexpr double transitionStepGrowth = 1.1;
+
+struct Point {
+  size_t size = 0;
+  double values[KERNELS_COUNT] = {};
+};
+
+volatile uint64_t sink = 0;
+
+void printHelp() {
+  std::cout << "options:\n";
+  std::cout << "-h : print help and quit\n";
+  std::cout << "-k <KERNEL,KERNEL,...> : kernels to run out of read, write, "
+               "copy and latency, default is all of them\n";
+  std::cout << "-n <NUMBER> : smallest working set in bytes, default is "
+            << defaultMinSize << "\n";
+  std::cout << "-m <NUMBER> : largest working set in bytes, default is 4 "
+               "times the last level cache or "
+            << defaultMaxSizeWithoutLlc << " if its size is unknown\n";
+  std::cout << "-p <NUMBER> : working sets per doubling of size, default is "
+            << defaultPointsPerOctave << "\n";
+  std::cout << "-i <NUMBER> : iterations per working set, median is reported, "
+               "default is "
+            << defaultIterations << "\n";
+  std::cout << "-f [csv,json] : output format, default is csv\n";
+  std::cout << "-o <FILE> : output file, default is standard output\n";
+}
+
+std::vector<size_t> getSizes(size_t minSize, size_t maxSize,
+                             size_t pointsPerOctave) {
+  const size_t lineSize = HostCache::getCacheLineSize();
+  std::vector<size_t> sizes{};
+  for (size_t point = 0;; point++) {
+    const double exactSize =
+        minSize * std::pow(2.0, static_cast<double>(point) / pointsPerOctave);
+    const size_t size = alignUp(static_cast<size_t>(exactSize), lineSize);
+    if (size > maxSize) {
+      break;
+    }
+    if (sizes.empty() || sizes.back() != size) {
+      sizes.push_back(size);
+    }
+  }
+  return sizes;
+}
+
+template <typename Body>
+double measureNanoseconds(const Body &body) {
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  const auto start = std::chrono::steady_clock::now();
+  body();
+  const auto end = std::chrono::steady_clock::now();
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  return static_cast<double>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+          .count());
+}
+
+uint64_t readWords(const uint64_t *words, size_t count) {
+  uint64_t sums[4] = {};
+  for (size_t i = 0; i + 4 <= count; i += 4) {
+    sums[0] += words[i + 0];
+    sums[1] += words[i + 1];
+    sums[2] += words[i + 2];
+    sums[3] += words[i + 3];
+  }
+  return sums[0] ^ sums[1] ^ sums[2] ^ sums[3];
+}
+
+void writeWords(uint64_t *words, size_t count, uint64_t value) {
+  for (size_t i = 0; i < count; i++) {
+    words[i] = value;
+  }
+}
+
+// Links cache lines of the working set into a single random cycle with
+// Sattolo's algorithm, so hardware prefetchers cannot predict the next line
+void createPointerCycle(uint8_t *buffer, size_t size) {
+  const size_t lineSize = HostCache::getCacheLineSize();
+  const size_t linesCount = size / lineSize;
+  std::vector<size_t> order(linesCount);
+  for (size_t line = 0; line < linesCount; line++) {
+    order[line] = line;
+  }
+  std::mt19937_64 generator{linesCount};
+  for (size_t line = linesCount - 1; line > 0; line--) {
+    std::uniform_int_distribution<size_t> distribution(0, line - 1);
+    std::swap(order[line], order[distribution(generator)]);
+  }
+  for (size_t line = 0; line < linesCount; line++) {
+    *reinterpret_cast<uint8_t **>(buffer + order[line] * lineSize) =
+        buffer + order[(line + 1) % linesCount] * lineSize;
+  }
+}
+
+double measure(Kernel kernel, uint8_t *buffer, size_t size) {
+  const size_t passes = std::max<size_t>(minimumBytesPerMeasurement / size, 1);
+  uint64_t *words = reinterpret_cast<uint64_t *>(buffer);
+  switch (kernel) {
+  case READ: {
+    const double time = measureNanoseconds([&] {
+      for (size_t pass = 0; pass < passes; pass++) {
+        sink = readWords(words, size / sizeof(uint64_t));
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+      }
+    });
+    return size * passes / time;
+  }
+  case WRITE: {
+    const double time = measureNanoseconds([&] {
+      for (size_t pass = 0; pass < passes; pass++) {
+        writeWords(words, size / sizeof(uint64_t), pass);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+      }
+    });
+    return size * passes / time;
+  }
+  case COPY: {
+    // Source and destination together form the working set. Both reads and
+    // writes are counted.
+    const size_t half = size / 2;
+    const double time = measureNanoseconds([&] {
+      for (size_t pass = 0; pass < passes; pass++) {
+        std::memcpy(buffer + half, buffer, half);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+      }
+    });
+    return 2 * half * passes / time;
+  }
+  case LATENCY: {
+    const size_t loads = std::max(size / HostCache::getCacheLineSize(),
+                                  minimumLoadsPerMeasurement);
+    uint8_t *line = buffer;
+    const double time = measureNanoseconds([&] {
+      for (size_t i = 0; i < loads; i++) {
+        line = *reinterpret_cast<uint8_t **>(line);
+      }
+    });
+    sink = reinterpret_cast<uintptr_t>(line);
+    return time / loads;
+  }
+  default:
+    return 0;
+  }
+}
+
+// Cost grows with each cache level which is exceeded, so latency is used
+// when measured and inverse of read bandwidth otherwise
+std::vector<size_t> detectBoundaries(const std::vector<Point> &points,
+                                     Kernel kernel) {
+  std::vector<double> costs{};
+  for (const auto &point : points) {
+    const double value = point.values[kernel];
+    costs.push_back(kernel == LATENCY ? value : 1 / value);
+  }
+
+  std::vector<size_t> boundaries{};
+  for (size_t i = 1; i < costs.size(); i++) {
+    if (costs[i] <= costs[i - 1] * transitionStepGrowth) {
+      continue;
+    }
+    const size_t start = i - 1;
+    size_t end = i;
+    while (end + 1 < costs.size() &&
+           costs[end + 1] > costs[end] * transitionStepGrowth) {
+      end++;
+    }
+    if (costs[end] > costs[start] * boundaryGrowth) {
+      boundaries.push_back(points[start].size);
+    }
+    i = end;
+  }
+  return boundaries;
+}
+
+std::string formatSize(size_t size) {
+  std::ostringstream stream{};
+  stream << std::setprecision(3);
+  if (size >= megaByte) {
+    stream << static_cast<double>(size) / megaByte << "MB";
+  } else {
+    stream << static_cast<double>(size) / kiloByte << "KB";
+  }
+  return stream.str();
+}
+
+std::string getBoundariesDescription(const std::vector<size_t> &boundaries) {
+  std::string description{};
+  for (size_t level = 0; level < boundaries.size(); level++) {
+    if (!description.empty()) {
+      description += ", ";
+    }
+    description +=
+        "L" + std::to_string(level + 1) + " " + formatSize(boundaries[level]);
+  }
+  return description;
+}
+
+void printCsv(std::ostream &out, const std::vector<Point> &points,
+              const bool (&enabled)[KERNELS_COUNT],
+              const std::vector<size_t> &boundaries) {
+  out << "# reported caches: " << HostCache::getCachesDescription() << "\n";
+  out << "# detected caches: " << getBoundariesDescription(boundaries)
+      << "\n";
+  out << "size [B]";
+  for (size_t kernel = 0; kernel < KERNELS_COUNT; kernel++) {
+    if (enabled[kernel]) {
+      out << "," << kernelNames[kernel] << " [" << kernelUnits[kernel] << "]";
+    }
+  }
+  out << "\n";
+  out << std::fixed << std::setprecision(3);
+  for (const auto &point : points) {
+    out << point.size;
+    for (size_t kernel = 0; kernel < KERNELS_COUNT; kernel++) {
+      if (enabled[kernel]) {
+        out << "," << point.values[kernel];
+      }
+    }
+    out << "\n";
+  }
+}
+
+void printJson(std::ostream &out, const std::vector<Point> &points,
+               const bool (&enabled)[KERNELS_COUNT],
+               const std::vector<size_t> &boundaries) {
+  out << "{\n";
+  out << "  \"reportedCaches\": {";
+  bool first = true;
+  for (size_t level = 1; level <= 4; level++) {
+    if (const size_t size = HostCache::getCacheSize(level); size != 0) {
+      out << (first ? "" : ", ") << "\"L" << level << "\": " << size;
+      first = false;
+    }
+  }
+  out << "},\n";
+  out << "  \"detectedCaches\": {";
+  for (size_t level = 0; level < boundaries.size(); level++) {
+    out << (level == 0 ? "" : ", ") << "\"L" << level + 1
+        << "\": " << boundaries[level];
+  }
+  out << "},\n";
+  out << "  \"units\": {";
+  first = true;
+  for (size_t kernel = 0; kernel < KERNELS_COUNT; kernel++) {
+    if (enabled[kernel]) {
+      out << (first ? "" : ", ") << "\"" << kernelNames[kernel] << "\": \""
+          << kernelUnits[kernel] << "\"";
+      first = false;
+    }
+  }
+  out << "},\n";
+  out << "  \"points\": [\n";
+  out << std::fixed << std::setprecision(3);
+  for (size_t i = 0; i < points.size(); i++) {
+    out << "    {\"size\": " << points[i].size;
+    for (size_t kernel = 0; kernel < KERNELS_COUNT; kernel++) {
+      if (enabled[kernel]) {
+        out << ", \"" << kernelNames[kernel]
+            << "\": " << points[i].values[kernel];
+      }
+    }
+    out << "}" << (i + 1 < points.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+int main(int argc, char **argv) {
+  bool enabled[KERNELS_COUNT] = {true, true, true, true};
+  size_t minSize = defaultMinSize;
+  size_t maxSize = 4 * HostCache::getLastLevelCacheSize();
+  size_t pointsPerOctave = defaultPointsPerOctave;
+  size_t iterations = defaultIterations;
+  bool json = false;
+  std::string outputFile{};
+
+  // Buffer is allocated according to the default configuration
+  Configuration::loadDefaultConfiguration();
+
+  if (maxSize == 0) {
+    maxSize = defaultMaxSizeWithoutLlc;
+  }
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp("-h", argv[i])) {
+      printHelp();
+      return 0;
+    } else if (i + 1 == argc) {
+      std::cout << "Missing value of " << argv[i] << "\n";
+      return 1;
+    } else if (!strcmp("-k", argv[i])) {
+      std::fill(std::begin(enabled), std::end(enabled), false);
+      auto name = strtok(argv[++i], ",");
+      while (name != NULL) {
+        const auto kernel = std::find_if(
+            std::begin(kernelNames), std::end(kernelNames),
+            [&](const char *known) { return !strcmp(known, name); });
+        if (kernel == std::end(kernelNames)) {
+          std::cout << "Unknown kernel " << name << "\n";
+          return 1;
+        }
+        enabled[kernel - std::begin(kernelNames)] = true;
+        name = strtok(NULL, ",");
+      }
+    } else if (!strcmp("-n", argv[i])) {
+      minSize = std::strtoull(argv[++i], nullptr, 10);
+    } else if (!strcmp("-m", argv[i])) {
+      maxSize = std::strtoull(argv[++i], nullptr, 10);
+    } else if (!strcmp("-p", argv[i])) {
+      pointsPerOctave = std::strtoull(argv[++i], nullptr, 10);
+    } else if (!strcmp("-i", argv[i])) {
+      iterations = std::strtoull(argv[++i], nullptr, 10);
+    } else if (!strcmp("-f", argv[i])) {
+      i++;
+      if (!strcmp("csv", argv[i])) {
+        json = false;
+      } else if (!strcmp("json", argv[i])) {
+        json = true;
+      } else {
+        std::cout << "Unknown output format " << argv[i] << "\n";
+        return 1;
+      }
+    } else if (!strcmp("-o", argv[i])) {
+      outputFile = argv[++i];
+    } else {
+      std::cout << "Unknown option " << argv[i] << "\n";
+      return 1;
+    }
+  }
+
+  const size_t lineSize = HostCache::getCacheLineSize();
+  if (minSize < 2 * lineSize || maxSize < minSize || pointsPerOctave == 0 ||
+      iterations == 0) {
+    std::cout << "Invalid working set sizes, points or iterations\n";
+    return 1;
+  }
+
+  // Transparent huge pages keep TLB misses from adding steps to the curve
+  void *allocation = HostAllocator::allocate(
+      maxSize, lineSize, HostAllocationPolicy::TransparentHugePages);
+  uint8_t *buffer = static_cast<uint8_t *>(allocation);
+  std::memset(buffer, 1, maxSize);
+
+  std::vector<Point> points{};
+  std::vector<double> samples(iterations);
+  for (const size_t size : getSizes(minSize, maxSize, pointsPerOctave)) {
+    Point point{};
+    point.size = size;
+    for (size_t kernel = 0; kernel < KERNELS_COUNT; kernel++) {
+      if (!enabled[kernel]) {
+        continue;
+      }
+      if (kernel == LATENCY) {
+        createPointerCycle(buffer, size);
+      }
+
+      // Warmup brings the working set into the caches
+      measure(static_cast<Kernel>(kernel), buffer, size);
+      for (auto &sample : samples) {
+        sample = measure(static_cast<Kernel>(kernel), buffer, size);
+      }
+      std::nth_element(samples.begin(), samples.begin() + iterations / 2,
+                       samples.end());
+      point.values[kernel] = samples[iterations / 2];
+    }
+    points.push_back(point);
+    std::cerr << "\r" << points.size() << " working sets measured"
+              << std::flush;
+  }
+  std::cerr << "\n";
+
+  std::vector<size_t> boundaries{};
+  if (enabled[LATENCY] || enabled[READ]) {
+    boundaries = detectBoundaries(points, enabled[LATENCY] ? LATENCY : READ);
+  }
+
+  std::ofstream file{};
+  if (!outputFile.empty()) {
+    file.open(outputFile);
+    if (!file) {
+      std::cout << "Cannot open " << outputFile << "\n";
+      HostAllocator::free(allocation);
+      return 1;
+    }
+  }
+  std::ostream &out = outputFile.empty() ? std::cout : file;
+  if (json) {
+    printJson(out, points, enabled, boundaries);
+  } else {
+    printCsv(out, points, enabled, boundaries);
+  }
+
+  HostAllocator::free(allocation);
+  return 0;
+}
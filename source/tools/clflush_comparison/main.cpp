@@ -5,12 +5,16 @@
  *
  */
 
+#include "framework/configuration.h"
+#include "framework/utility/buffer_contents_helper.h"
+#include "framework/utility/host_cache.h"
+#include "framework/utility/thread_team.h"
+
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
-#include <ctime>
 #include <emmintrin.h>
 #include <iostream>
 #include <memory>
@@ -18,40 +22,11 @@
 #include <string.h>
 #include <vector>
 
-#if defined(_WIN32)
-#include <Windows.h>
-#include <intrin.h>
-size_t getCachelineSize() {
-  DWORD lpiCount = 0;
-  GetLogicalProcessorInformation(nullptr, &lpiCount);
-
-  std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> lpis(lpiCount);
-  GetLogicalProcessorInformation(lpis.data(), &lpiCount);
-
-  for (const auto &lpi : lpis) {
-    if (lpi.Relationship == LOGICAL_PROCESSOR_RELATIONSHIP::RelationCache &&
-        lpi.Cache.Level == 1) {
-      return lpi.Cache.LineSize;
-    }
-  }
-  return 0;
-}
-#else
-#include <x86intrin.h>
-size_t getCachelineSize() { return 64; }
-#endif
-
-enum class CachelineFlushOp : uint32_t {
-  MM_CLFLUSH = 0,
-  MM_CLFLUSHOPT,
-  MM_CLWB
-};
+using CachelineFlushOp = HostCache::FlushInstruction;
 
 enum class OverrideMemType : uint32_t { NONE = 0, ONES, RANDOM };
 
-constexpr size_t constCachelineSize = 64;
-
-constexpr CachelineFlushOp defaultOpType = CachelineFlushOp::MM_CLFLUSHOPT;
+constexpr CachelineFlushOp defaultOpType = CachelineFlushOp::Clflushopt;
 constexpr OverrideMemType defaultOverrideMem = OverrideMemType::RANDOM;
 constexpr size_t defaultComparisonIterations = 10;
 constexpr size_t defaultClflushIterations = 1;
@@ -59,7 +34,7 @@ constexpr size_t defaultSizes[] = {1,    4,    8,       64,
                                    1024, 4096, 2097152, 2147483648};
 constexpr bool defaultAlign = false;
 constexpr bool defaultPrecise = false;
-constexpr bool defaultClSize = true;
+constexpr size_t defaultThreads = 1;
 
 void printHelp() {
   std::cout << "options:\n";
@@ -81,8 +56,9 @@ void printHelp() {
             << defaultAlign << "\n";
   std::cout << "-p [0,1] : substract cost of loops, default is "
             << defaultPrecise << "\n";
-  std::cout << "-t [0,1] : use compile time cl size = 64, default is "
-            << defaultClSize << "\n";
+  std::cout << "-j <NUMBER> : set count of threads flushing the memory, 0 "
+               "means one per logical core, default is "
+            << defaultThreads << "\n";
   std::cout << "-c [MM_CLFLUSH,MM_CLFLUSHOPT,MM_CLWB] : set clflush intrinsic "
                "type to be used, default is MM_CLFLUSHOPT \n";
 }
@@ -108,18 +84,18 @@ void printIteration(size_t size, std::vector<double> &vec) {
 void printInitialInfo(size_t cachelineSize, size_t comparisonIterations,
                       size_t clflushIterations, OverrideMemType overrideMem,
                       std::vector<size_t> &sizes, CachelineFlushOp clOp,
-                      bool alignMem, bool precise, bool constClSize) {
+                      bool alignMem, bool precise, size_t threads) {
   std::cout << "clflush statistics\n";
   std::cout << "cachelineSize: " << cachelineSize << "\n";
   std::cout << "comparisonIterations [-i]: " << comparisonIterations << "\n";
   std::cout << "clflushIterations [-m]: " << clflushIterations << "\n";
   std::cout << "overrideMem [-f]: " << static_cast<uint32_t>(overrideMem)
             << "\n";
-  std::cout << "cacheline flush type [-c]: " << static_cast<uint32_t>(clOp)
+  std::cout << "cacheline flush type [-c]: " << HostCache::toString(clOp)
             << "\n";
   std::cout << "alignment [-a]: " << alignMem << "\n";
   std::cout << "precise [-p]: " << precise << "\n";
-  std::cout << "constClSize [-t]: " << constClSize << "\n";
+  std::cout << "threads [-j]: " << threads << "\n";
   std::cout << "sizes [-s]:";
   for (const auto &size : sizes) {
     std::cout << " " << size << ",";
@@ -128,35 +104,12 @@ void printInitialInfo(size_t cachelineSize, size_t comparisonIterations,
 }
 
 void overrideMemoryOnes(std::vector<char> &mem) {
-  for (auto &byte : mem) {
-    byte = 1;
-  }
+  std::memset(mem.data(), 1, mem.size());
 }
 
 void overrideMemoryRandom(std::vector<char> &mem) {
-  srand(static_cast<unsigned>(time(NULL)));
-  for (auto &byte : mem) {
-    byte = rand();
-  }
-}
-
-template <CachelineFlushOp Op, bool constCachelineSize>
-void flushMemory(size_t cachelineSize, size_t size, char *ptr) {
-  const auto lastPtr = ptr + size;
-  while (ptr < lastPtr) {
-    if constexpr (Op == CachelineFlushOp::MM_CLFLUSH) {
-      _mm_clflush(ptr);
-    } else if constexpr (Op == CachelineFlushOp::MM_CLFLUSHOPT) {
-      _mm_clflushopt(ptr);
-    } else {
-      _mm_clwb(ptr);
-    }
-    if constexpr (constCachelineSize) {
-      ptr += 64;
-    } else {
-      ptr += cachelineSize;
-    }
-  }
+  BufferContentsHelper::fillWithRandomBytes(
+      reinterpret_cast<uint8_t *>(mem.data()), mem.size());
 }
 
 auto getTime() {
@@ -172,7 +125,10 @@ int main(int argc, char **argv) {
   CachelineFlushOp clOp = defaultOpType;
   bool alignMem = defaultAlign;
   bool precise = defaultPrecise;
-  bool constClSize = defaultClSize;
+  size_t threads = defaultThreads;
+
+  // Flushing threads are placed according to the default configuration
+  Configuration::loadDefaultConfiguration();
 
   std::vector<size_t> sizes{};
 
@@ -206,16 +162,16 @@ int main(int argc, char **argv) {
       clflushIterations = atoi(argv[++i]);
     } else if (!strcmp("-a", argv[i])) {
       alignMem = atoi(argv[++i]);
-    } else if (!strcmp("-t", argv[i])) {
-      constClSize = atoi(argv[++i]);
+    } else if (!strcmp("-j", argv[i])) {
+      threads = atoi(argv[++i]);
     } else if (!strcmp("-c", argv[i])) {
       i++;
       if (!strcmp("MM_CLFLUSH", argv[i])) {
-        clOp = CachelineFlushOp::MM_CLFLUSH;
+        clOp = CachelineFlushOp::Clflush;
       } else if (!strcmp("MM_CLFLUSHOPT", argv[i])) {
-        clOp = CachelineFlushOp::MM_CLFLUSHOPT;
+        clOp = CachelineFlushOp::Clflushopt;
       } else if (!strcmp("MM_CLWB", argv[i])) {
-        clOp = CachelineFlushOp::MM_CLWB;
+        clOp = CachelineFlushOp::Clwb;
       } else {
         std::cout << "Unknown cacheline flush type \n";
         return 0;
@@ -229,27 +185,20 @@ int main(int argc, char **argv) {
     }
   }
 
-  auto flushMemFunc = clOp == CachelineFlushOp::MM_CLFLUSH
-                          ? &flushMemory<CachelineFlushOp::MM_CLFLUSH, false>
-                      : clOp == CachelineFlushOp::MM_CLFLUSHOPT
-                          ? &flushMemory<CachelineFlushOp::MM_CLFLUSHOPT, false>
-                          : &flushMemory<CachelineFlushOp::MM_CLWB, false>;
-  if (constClSize) {
-    flushMemFunc = clOp == CachelineFlushOp::MM_CLFLUSH
-                       ? &flushMemory<CachelineFlushOp::MM_CLFLUSH, true>
-                   : clOp == CachelineFlushOp::MM_CLFLUSHOPT
-                       ? &flushMemory<CachelineFlushOp::MM_CLFLUSHOPT, true>
-                       : &flushMemory<CachelineFlushOp::MM_CLWB, true>;
+  if (!HostCache::isSupported(clOp)) {
+    std::cout << HostCache::toString(clOp) << " is not supported\n";
+    return 0;
   }
 
-  const auto cachelineSize = getCachelineSize();
+  ThreadTeam team{threads};
+  const auto cachelineSize = HostCache::getCacheLineSize();
   if (cachelineSize == 0) {
     std::cout << "Query cacheline size failed\n";
     return 0;
   }
 
   printInitialInfo(cachelineSize, comparisonIterations, clflushIterations,
-                   overrideMem, sizes, clOp, alignMem, precise, constClSize);
+                   overrideMem, sizes, clOp, alignMem, precise, threads);
 
   for (const auto size : sizes) {
     std::vector<double> times;
@@ -275,7 +224,7 @@ int main(int argc, char **argv) {
       auto start = getTime();
 
       for (size_t j = 0; j < clflushIterations; ++j) {
-        flushMemFunc(cachelineSize, size, static_cast<char *>(ptrToFlush));
+        HostCache::flush(ptrToFlush, size, clOp, team);
       }
 
       auto end = getTime();
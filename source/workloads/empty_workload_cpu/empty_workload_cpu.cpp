@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/timer.h"
+#include "framework/workload/register_workload.h"
+
+struct EmptyArguments : WorkloadArgumentContainer {
+  EmptyArguments() { synchronize = true; }
+};
+
+struct Empty : Workload<EmptyArguments> {};
+
+TestResult run(const EmptyArguments &arguments, Statistics &statistics,
+               WorkloadSynchronization &synchronization, WorkloadIo &io) {
+  // Workload does not do any work. It only reports to the parent process
+  // that it is alive, so the parent can measure the cost of process creation.
+  Timer timer{};
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    timer.measureStart();
+    synchronization.synchronize(io);
+    timer.measureEnd();
+
+    statistics.pushValue(timer.get(), MeasurementUnit::Unknown,
+                         MeasurementType::Unknown);
+  }
+
+  return TestResult::Success;
+}
+
+int main(int argc, char **argv) {
+  Empty workload;
+  Empty::implementation = run;
+  return workload.runFromCommandLine(argc, argv);
+}
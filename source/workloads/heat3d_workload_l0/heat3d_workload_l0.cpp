@@ -70,11 +70,7 @@
 
 struct Heat3DArguments : WorkloadArgumentContainer {
   IntegerArgument rank;
-  PositiveIntegerArgument parentPid;
-#ifdef USE_PIDFD
-  StringArgument initBufferIpcHandle;
-  StringArgument evPoolIpcHandle;
-#endif // USE_PIDFD
+  IntegerArgument rendezvousFd;
   PositiveIntegerArgument nSubDomainX;
   PositiveIntegerArgument nSubDomainY;
   PositiveIntegerArgument nSubDomainZ;
@@ -83,13 +79,8 @@ struct Heat3DArguments : WorkloadArgumentContainer {
 
   Heat3DArguments()
       : rank(*this, "rank", "Execution rank of this process"),
-        parentPid(*this, "parentPid", "PID of the parent process"),
-#ifdef USE_PIDFD
-        initBufferIpcHandle(*this, "initBufferIpcHandle",
-                            "IPC handle of the shared initialization buffer"),
-        evPoolIpcHandle(*this, "evPoolIpcHandle",
-                        "IPC handle of the Level Zero event pool"),
-#endif // USE_PIDFD
+        rendezvousFd(*this, "rendezvousFd",
+                     "Inherited descriptor of the IPC rendezvous directory"),
         nSubDomainX(*this, "nSubDomainX",
                     "Number of sub-domains in the X-direction"),
         nSubDomainY(*this, "nSubDomainY",
@@ -114,11 +105,10 @@ TestResult run(const Heat3DArguments &, Statistics &, WorkloadSynchronization &,
 
 #else // WIN32
 
-#include "framework/utility/linux/ipc.h"
+#include "framework/utility/linux/ipc_rendezvous.h"
 
-#ifndef USE_PIDFD
-const std::string masterSocketName{"/tmp/heat3d.socket"};
-#endif // USE_PIDFD
+#include <cstring>
+#include <memory>
 
 // Identify the six facets of a sub-domain
 enum class FacetTy : uint8_t {
@@ -167,13 +157,10 @@ struct ParamsTy {
   ze_kernel_handle_t kernelInitTemp{}, kernelPackSendBuf{},
       kernelUnpackRecvBuf{}, kernelUpdateFacet{}, kernelUpdateInterior{};
   ze_command_list_handle_t cmdlist{}; // Immediate
-  void *initBuffer = nullptr;
   ze_event_pool_handle_t barrierEvPool{};
   std::vector<ze_event_handle_t> barrierEvents{};
-
-#ifndef USE_PIDFD
-  int socketWorker{};
-#endif // USE_PIDFD
+  // Directory of IPC handles shared with the parent and the other ranks
+  std::unique_ptr<IpcRendezvous> rendezvous{};
 
   uint32_t rank{}, nRanks{};
   // Number of sub-domains in each direction
@@ -200,12 +187,6 @@ struct ParamsTy {
   FacetInfoTy facetInfo[int(FacetTy::LAST)] = {};
 };
 
-// Stores the PID and the IPC handle for the halo exchange receive buffers
-struct HaloBufferInfoTy {
-  pid_t pid{};
-  ze_ipc_mem_handle_t ipcHandle{};
-};
-
 static TestResult ipcBarrierWorker(ParamsTy &params) {
   // Notify the master process
   ASSERT_ZE_RESULT_SUCCESS(
@@ -219,25 +200,18 @@ static TestResult ipcBarrierWorker(ParamsTy &params) {
   return TestResult::Success;
 }
 
-#ifdef USE_PIDFD
-
-static TestResult deserializeAndPatchIpcHandle(const pid_t parentPid,
-                                               std::string handleDataStr,
-                                               void *handleData) {
-  deserializeStrToBinary(handleData, handleDataStr);
-  const int parentFd = *reinterpret_cast<int *>(handleData);
-  if (parentFd <= 0) {
-    return TestResult::Error;
-  }
-  int fd = -1;
-  translateParentFd(parentPid, parentFd, fd);
-  *reinterpret_cast<int *>(handleData) = fd;
-
-  return TestResult::Success;
+// Rebuilds an IPC handle received from a peer. Its first bytes carry a file
+// descriptor, which is only valid in the process that published it.
+template <typename IpcHandleT>
+static IpcHandleT getPeerIpcHandle(const IpcRendezvous &rendezvous,
+                                   uint32_t rank, uint32_t slot) {
+  IpcHandleT ipcHandle{};
+  std::memcpy(ipcHandle.data, rendezvous.getData(rank, slot),
+              ZE_MAX_IPC_HANDLE_SIZE);
+  *reinterpret_cast<int *>(ipcHandle.data) = rendezvous.getFd(rank, slot);
+  return ipcHandle;
 }
 
-#endif // USE_PIDFD
-
 static uint32_t subDomainCoordToRank(const uint32_t x, const uint32_t y,
                                      const uint32_t z, const ParamsTy &params) {
   return x * params.nSubDomainY * params.nSubDomainZ + y * params.nSubDomainZ +
@@ -608,44 +582,17 @@ static TestResult initParams(ParamsTy &params,
 
   params.barrierEvents.resize(2 * params.nRanks);
 
-#ifdef USE_PIDFD
-  ze_ipc_event_pool_handle_t evPoolIpcHandle{};
-  deserializeAndPatchIpcHandle(arguments.parentPid,
-                               std::string(arguments.evPoolIpcHandle),
-                               evPoolIpcHandle.data);
-  ASSERT_ZE_RESULT_SUCCESS(zeEventPoolOpenIpcHandle(
-      params.levelzero.context, evPoolIpcHandle, &params.barrierEvPool));
-
-  ze_ipc_mem_handle_t initBufferIpcHandle{};
-  deserializeAndPatchIpcHandle(arguments.parentPid,
-                               std::string(arguments.initBufferIpcHandle),
-                               initBufferIpcHandle.data);
-  ASSERT_ZE_RESULT_SUCCESS(
-      zeMemOpenIpcHandle(params.levelzero.context, params.levelzero.device,
-                         initBufferIpcHandle, 0, &params.initBuffer));
-#else
-  socketCreate(params.socketWorker);
-  socketConnect(params.socketWorker, masterSocketName);
-
-  int fd = -1;
-
-  ze_ipc_mem_handle_t initBufferIpcHandle{};
-  std::fill_n(initBufferIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE, 0);
-  socketRecvDataWithFd(params.socketWorker, fd, initBufferIpcHandle.data,
-                       ZE_MAX_IPC_HANDLE_SIZE);
-  *reinterpret_cast<int *>(initBufferIpcHandle.data) = fd;
-  ASSERT_ZE_RESULT_SUCCESS(
-      zeMemOpenIpcHandle(params.levelzero.context, params.levelzero.device,
-                         initBufferIpcHandle, 0, &params.initBuffer));
-
-  ze_ipc_event_pool_handle_t barrierEvPoolIpcHandle{};
-  std::fill_n(barrierEvPoolIpcHandle.data, ZE_MAX_IPC_HANDLE_SIZE, 0);
-  socketRecvDataWithFd(params.socketWorker, fd, barrierEvPoolIpcHandle.data,
-                       ZE_MAX_IPC_HANDLE_SIZE);
-  *reinterpret_cast<int *>(barrierEvPoolIpcHandle.data) = fd;
+  // The parent takes the rank after the last worker and publishes the event
+  // pool used for barriers
+  const uint32_t parentRank = params.nRanks;
+  params.rendezvous =
+      std::make_unique<IpcRendezvous>(static_cast<int>(arguments.rendezvousFd));
+  params.rendezvous->setRank(params.rank);
+  params.rendezvous->exchange({parentRank});
+  auto barrierEvPoolIpcHandle = getPeerIpcHandle<ze_ipc_event_pool_handle_t>(
+      *params.rendezvous, parentRank, 0);
   ASSERT_ZE_RESULT_SUCCESS(zeEventPoolOpenIpcHandle(
       params.levelzero.context, barrierEvPoolIpcHandle, &params.barrierEvPool));
-#endif // USE_PIDFD
 
   ze_event_desc_t barrierEventDesc = {};
   barrierEventDesc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
@@ -688,111 +635,31 @@ static TestResult initParams(ParamsTy &params,
   ASSERT_ZE_RESULT_SUCCESS(
       zeKernelCreate(params.module, &kernelDesc, &params.kernelUpdateInterior));
 
-#ifdef USE_PIDFD
-  // Write receive buffers' IPC handles into shared init buffer
-  for (int i = 0; i < int(FacetTy::LAST); i++) {
-    const size_t initBufferOffset = (6 * params.rank + i) * 1024;
-    HaloBufferInfoTy *haloBufferInfoPtr = reinterpret_cast<HaloBufferInfoTy *>(
-        static_cast<uint8_t *>(params.initBuffer) + initBufferOffset);
-    haloBufferInfoPtr->pid = getpid();
-    std::fill_n(haloBufferInfoPtr->ipcHandle.data, ZE_MAX_IPC_HANDLE_SIZE, 0);
-    ASSERT_ZE_RESULT_SUCCESS(zeMemGetIpcHandle(params.levelzero.context,
-                                               params.recvBuffers[i],
-                                               &haloBufferInfoPtr->ipcHandle));
-  }
-
-  ipcBarrierWorker(params);
-
-  // Find each facet's neighbor rank's receive buffer, and store the address
-  for (int i = 0; i < int(FacetTy::LAST); i++) {
-    const uint32_t neighborRank = params.neighbors[i];
-    const size_t neighborInitBufferOffset =
-        (6 * neighborRank + int(reverseFacetUD(FacetTy(i)))) * 1024;
-    HaloBufferInfoTy *haloBufferInfoPtr = reinterpret_cast<HaloBufferInfoTy *>(
-        static_cast<uint8_t *>(params.initBuffer) + neighborInitBufferOffset);
-    ze_ipc_mem_handle_t ipcHandle = haloBufferInfoPtr->ipcHandle;
-    const int parentFd = *reinterpret_cast<int *>(ipcHandle.data);
-    EXPECT_TRUE(parentFd > 0);
-    int fd = -1;
-    translateParentFd(haloBufferInfoPtr->pid, parentFd, fd);
-    EXPECT_TRUE(fd > 0);
-    *reinterpret_cast<int *>(ipcHandle.data) = fd;
-    ASSERT_ZE_RESULT_SUCCESS(zeMemOpenIpcHandle(
-        params.levelzero.context, params.levelzero.device, ipcHandle, 0,
-        reinterpret_cast<void **>(&params.facetInfo[i].recvBufferNeighbor)));
-  }
-#else
-  std::vector<std::vector<ze_ipc_mem_handle_t>> ipcHandles{params.nRanks};
-  for (uint32_t r = 0; r < params.nRanks; r++) {
-    ipcHandles[r].resize(int(FacetTy::LAST));
-    for (int f = 0; f < int(FacetTy::LAST); f++) {
-      std::fill_n(ipcHandles[r][f].data, ZE_MAX_IPC_HANDLE_SIZE, 0);
-      if (r == params.rank) {
-        ASSERT_ZE_RESULT_SUCCESS(zeMemGetIpcHandle(params.levelzero.context,
-                                                   params.recvBuffers[f],
-                                                   &ipcHandles[r][f]));
-      }
-    }
-  }
-
-  for (uint32_t r = 0; r < params.nRanks; r++) {
-    if (params.nRanks == 1) {
-      break;
-    }
-    int ipcSocket = -1;
-    socketCreate(ipcSocket);
-    EXPECT_TRUE(ipcSocket > 0);
-    const std::string socketName =
-        "/tmp/heat3d_" + std::to_string(r) + ".socket";
-
-    ipcBarrierWorker(params);
-
-    if (r == params.rank) {
-      socketBindAndListen(ipcSocket, socketName);
-
-      std::vector<int> socketOthers{};
-      for (uint32_t rankOther = 0; rankOther < params.nRanks; rankOther++) {
-        if (rankOther == r) {
-          continue;
-        }
-        int socketOther = -1;
-        socketAccept(ipcSocket, socketOthers, socketOther);
-        for (int f = 0; f < int(FacetTy::LAST); f++) {
-          const int fd = *reinterpret_cast<int *>(ipcHandles[r][f].data);
-          socketSendDataWithFd(socketOther, fd, ipcHandles[r][f].data,
-                               ZE_MAX_IPC_HANDLE_SIZE);
-        }
-      }
-      for (int socketOther : socketOthers) {
-        EXPECT_EQ(0, close(socketOther));
-      }
-      EXPECT_EQ(0, unlink(socketName.c_str()));
-    } else {
-      usleep(50000 * (params.nRanks - params.rank));
-      socketConnect(ipcSocket, socketName);
-      for (int f = 0; f < int(FacetTy::LAST); f++) {
-        int fd = -1;
-        socketRecvDataWithFd(ipcSocket, fd, ipcHandles[r][f].data,
-                             ZE_MAX_IPC_HANDLE_SIZE);
-        EXPECT_TRUE(fd > 0);
-        *reinterpret_cast<int *>(ipcHandles[r][f].data) = fd;
-      }
-    }
-
-    ipcBarrierWorker(params);
-
-    EXPECT_EQ(0, close(ipcSocket));
+  // Publish receive buffers' IPC handles and fetch the ones of the neighbors
+  // in a single exchange
+  ze_ipc_mem_handle_t ipcHandles[int(FacetTy::LAST)] = {};
+  for (int f = 0; f < int(FacetTy::LAST); f++) {
+    ASSERT_ZE_RESULT_SUCCESS(zeMemGetIpcHandle(
+        params.levelzero.context, params.recvBuffers[f], &ipcHandles[f]));
+    params.rendezvous->publish(f, ipcHandles[f].data, ZE_MAX_IPC_HANDLE_SIZE,
+                               *reinterpret_cast<int *>(ipcHandles[f].data));
   }
+  params.rendezvous->exchange(std::vector<uint32_t>(
+      std::begin(params.neighbors), std::end(params.neighbors)));
 
   for (int f = 0; f < int(FacetTy::LAST); f++) {
     const uint32_t neighborRank = params.neighbors[f];
     const int neighborFacet = int(reverseFacetUD(FacetTy(f)));
-    auto ipcHandle = ipcHandles[neighborRank][neighborFacet];
+    // With periodic boundaries a rank can be its own neighbor
+    const auto ipcHandle =
+        neighborRank == params.rank
+            ? ipcHandles[neighborFacet]
+            : getPeerIpcHandle<ze_ipc_mem_handle_t>(
+                  *params.rendezvous, neighborRank, neighborFacet);
     ASSERT_ZE_RESULT_SUCCESS(zeMemOpenIpcHandle(
         params.levelzero.context, params.levelzero.device, ipcHandle, 0,
         reinterpret_cast<void **>(&params.facetInfo[f].recvBufferNeighbor)));
   }
-#endif // USE_PIDFD
 
   return TestResult::Success;
 }
@@ -1080,12 +947,7 @@ static TestResult cleanupParams(ParamsTy &params) {
     ASSERT_ZE_RESULT_SUCCESS(zeEventDestroy(event));
   }
   ASSERT_ZE_RESULT_SUCCESS(zeEventPoolCloseIpcHandle(params.barrierEvPool));
-  ASSERT_ZE_RESULT_SUCCESS(
-      zeMemCloseIpcHandle(params.levelzero.context, params.initBuffer));
-
-#ifndef USE_PIDFD
-  EXPECT_EQ(0, close(params.socketWorker));
-#endif
+  params.rendezvous.reset();
 
   return TestResult::Success;
 }
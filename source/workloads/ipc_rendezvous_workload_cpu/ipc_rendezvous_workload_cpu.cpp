@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "framework/utility/linux/ipc_rendezvous.h"
+#include "framework/utility/timer.h"
+#include "framework/workload/register_workload.h"
+
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+struct IpcRendezvousArguments : WorkloadArgumentContainer {
+  IntegerArgument rank;
+  IntegerArgument rendezvousFd;
+
+  IpcRendezvousArguments()
+      : rank(*this, "rank", "Rank of this process in the rendezvous"),
+        rendezvousFd(*this, "rendezvousFd",
+                     "Inherited descriptor of the IPC rendezvous directory") {}
+};
+
+struct IpcRendezvousWorkload : Workload<IpcRendezvousArguments> {};
+
+// Each published descriptor is a memfd with a unique content, so the receiver
+// can verify it got the right file and not only some valid descriptor
+struct SlotContent {
+  uint32_t rank;
+  uint32_t slot;
+  uint32_t iteration;
+};
+
+TestResult run(const IpcRendezvousArguments &arguments, Statistics &statistics,
+               WorkloadSynchronization &, WorkloadIo &) {
+  IpcRendezvous rendezvous{static_cast<int>(arguments.rendezvousFd)};
+  const auto rank = static_cast<uint32_t>(arguments.rank);
+  rendezvous.setRank(rank);
+
+  std::vector<uint32_t> peers = {};
+  for (auto peer = 0u; peer < rendezvous.getParticipantsCount(); peer++) {
+    peers.push_back(peer);
+  }
+
+  Timer timer{};
+  for (auto i = 0u; i < arguments.iterations; i++) {
+    std::vector<int> fds(rendezvous.getSlotsCount(), -1);
+    for (auto slot = 0u; slot < fds.size(); slot++) {
+      const SlotContent content{rank, slot, i};
+      fds[slot] = memfd_create("ipc_rendezvous_slot", MFD_CLOEXEC);
+      if (fds[slot] < 0 ||
+          write(fds[slot], &content, sizeof(content)) != sizeof(content)) {
+        return TestResult::Error;
+      }
+      rendezvous.publish(slot, &content, sizeof(content), fds[slot]);
+    }
+
+    timer.measureStart();
+    rendezvous.exchange(peers);
+    timer.measureEnd();
+
+    for (uint32_t peer : peers) {
+      for (auto slot = 0u; slot < fds.size(); slot++) {
+        if (peer == rank) {
+          continue;
+        }
+        const SlotContent expected{peer, slot, i};
+        SlotContent published{};
+        SlotContent received{};
+        std::memcpy(&published, rendezvous.getData(peer, slot),
+                    sizeof(published));
+        const int receivedFd = rendezvous.getFd(peer, slot);
+        if (receivedFd < 0 ||
+            pread(receivedFd, &received, sizeof(received), 0) !=
+                sizeof(received) ||
+            std::memcmp(&expected, &published, sizeof(expected)) != 0 ||
+            std::memcmp(&expected, &received, sizeof(expected)) != 0) {
+          return TestResult::VerificationFail;
+        }
+      }
+    }
+
+    for (int fd : fds) {
+      close(fd);
+    }
+
+    statistics.pushValue(timer.get(), MeasurementUnit::Unknown,
+                         MeasurementType::Unknown);
+  }
+
+  return TestResult::Success;
+}
+
+int main(int argc, char **argv) {
+  IpcRendezvousWorkload workload;
+  IpcRendezvousWorkload::implementation = run;
+  return workload.runFromCommandLine(argc, argv);
+}